@@ -0,0 +1,28 @@
+#include "aiScheduler.h"
+
+namespace Tmpl8 {
+
+	void AiScheduler::BeginTick( vec2 _playerPos, bool _goldActive, vec2 _goldPos )
+	{
+		tick++;
+		playerPos = _playerPos;
+		goldActive = _goldActive;
+		goldPos = _goldPos;
+	}
+
+	bool AiScheduler::ShouldUpdate( unsigned int id, vec2 pos ) const
+	{
+		const unsigned int period = GetPeriod( pos );
+		return (id % period) == (tick % period);
+	}
+
+	unsigned int AiScheduler::GetPeriod( vec2 pos ) const
+	{
+		if (goldActive && (pos - goldPos).sqrLentgh() <= goldDist * goldDist) { return 1; }
+
+		const float squaredDist = (pos - playerPos).sqrLentgh();
+		if (squaredDist <= nearDist * nearDist) { return 1; }
+		if (squaredDist <= midDist * midDist) { return 2; }
+		return 4;
+	}
+}
\ No newline at end of file
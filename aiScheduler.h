@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cmath>
+
+#include "template.h"
+
+namespace Tmpl8 {
+
+	/* Decides which coals recalculate their steering this tick */
+	/* Coals far away from the player steer less often, the others keep their last steering in between */
+	class AiScheduler
+	{
+	public:
+		/* Call once per tick, before the coals are updated */
+		void BeginTick( vec2 playerPos, bool goldActive, vec2 goldPos );
+		/* Coals are spread over the ticks by their id, so only a part of the far away coals steer each tick */
+		[[nodiscard]] bool ShouldUpdate( unsigned int id, vec2 pos ) const;
+		/* Returns after how many ticks a coal at pos steers again (1, 2 or 4) */
+		[[nodiscard]] unsigned int GetPeriod( vec2 pos ) const;
+
+	private:
+		unsigned int tick{ 0 };
+		vec2 playerPos{ 0.0f, 0.0f };
+		bool goldActive{ false };
+		vec2 goldPos{ 0.0f, 0.0f };
+
+		/* Coals within this distance of the player steer every tick */
+		static constexpr float nearDist{ 192.0f };
+		/* Coals within this distance of the player steer every 2nd tick, the rest every 4th tick */
+		static constexpr float midDist{ 384.0f };
+		/* Coals within this distance of the active gold coal steer every tick, to avoid it in time */
+		static constexpr float goldDist{ 128.0f };
+	};
+}
\ No newline at end of file
@@ -0,0 +1,144 @@
+#include "assetManager.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace Tmpl8 {
+
+	AssetManager::AssetManager( JobSystem& _jobSystem )
+		: jobSystem( _jobSystem )
+	{}
+
+	AssetManager::~AssetManager()
+	{
+		for (const auto& job : jobs)
+		{
+			jobSystem.Wait( job );
+		}
+	}
+
+	std::shared_future<std::shared_ptr<Sprite>> AssetManager::LoadSprite( std::shared_ptr<Sprite>& target, const char* file,
+																			unsigned int frames, AssetGroup group )
+	{
+		queued[static_cast<size_t>(group)]++;
+
+		auto promise = std::make_shared<std::promise<std::shared_ptr<Sprite>>>();
+		std::shared_future<std::shared_ptr<Sprite>> future = promise->get_future().share();
+
+		jobs.push_back( jobSystem.SubmitBackground( [this, &target, path = std::string( file ), frames, group, promise]() mutable
+		{
+			/* Surface only takes a non-const char* */
+			auto sprite = std::make_shared<Sprite>( new Surface( path.data() ), frames );
+			/* Queue the publish first, a waiter on the future runs Update() right after it wakes up */
+			Finish( group, [&target, sprite] { target = sprite; } );
+			promise->set_value( sprite );
+		}, "decode sprite" ) );
+
+		return future;
+	}
+
+	std::shared_future<void> AssetManager::LoadSound( Audio::VoicePool& target, const char* file, unsigned int voiceCount, int priority,
+													float volume, AssetGroup group )
+	{
+		queued[static_cast<size_t>(group)]++;
+
+		auto promise = std::make_shared<std::promise<void>>();
+		std::shared_future<void> future = promise->get_future().share();
+
+		jobs.push_back( jobSystem.SubmitBackground( [this, &target, path = std::string( file ), voiceCount, priority, volume, group, promise]
+		{
+			Audio::VoicePool sound{ path, voiceCount, priority };
+			sound.setVolume( volume );
+			Finish( group, [&target, sound] { target = sound; } );
+			promise->set_value();
+		}, "decode sound" ) );
+
+		return future;
+	}
+
+	std::shared_future<void> AssetManager::GenerateSound( Audio::VoicePool& target, const Audio::SynthPreset& preset, unsigned int voiceCount,
+														  int priority, float volume, AssetGroup group )
+	{
+		queued[static_cast<size_t>(group)]++;
+
+		auto promise = std::make_shared<std::promise<void>>();
+		std::shared_future<void> future = promise->get_future().share();
+
+		jobs.push_back( jobSystem.SubmitBackground( [this, &target, preset, voiceCount, priority, volume, group, promise]
+		{
+			Audio::VoicePool sound{ preset, voiceCount, priority };
+			sound.setVolume( volume );
+			Finish( group, [&target, sound] { target = sound; } );
+			promise->set_value();
+		}, "generate sound" ) );
+
+		return future;
+	}
+
+	void AssetManager::Update()
+	{
+		std::vector<FinishedAsset> ready;
+		{
+			std::lock_guard<std::mutex> lock( finishedMutex );
+			ready.swap( finished );
+		}
+
+		for (auto& asset : ready)
+		{
+			asset.publish();
+			published[static_cast<size_t>(asset.group)]++;
+		}
+
+		/* Sprites evicted by the SpriteCache are loaded again, so drop the handles of finished jobs */
+		/* instead of keeping one for every load of the session */
+		jobs.erase( std::remove_if( jobs.begin(), jobs.end(), []( const JobHandle& job ) { return job.IsDone(); } ), jobs.end() );
+	}
+
+	void AssetManager::Wait( AssetGroup group )
+	{
+		Update();
+		while (!IsReady( group ))
+		{
+			{
+				std::unique_lock<std::mutex> lock( finishedMutex );
+				assetFinished.wait( lock, [this] { return !finished.empty(); } );
+			}
+			Update();
+		}
+	}
+
+	bool AssetManager::IsReady( AssetGroup group ) const
+	{
+		return published[static_cast<size_t>(group)] == queued[static_cast<size_t>(group)];
+	}
+
+	float AssetManager::GetProgress( AssetGroup group ) const
+	{
+		const unsigned int total = queued[static_cast<size_t>(group)];
+		if (total == 0) { return 1.0f; }
+
+		return static_cast<float>(published[static_cast<size_t>(group)]) / static_cast<float>(total);
+	}
+
+	float AssetManager::GetProgress() const
+	{
+		unsigned int total = 0, done = 0;
+		for (size_t i = 0; i < queued.size(); ++i)
+		{
+			total += queued[i];
+			done += published[i];
+		}
+		if (total == 0) { return 1.0f; }
+
+		return static_cast<float>(done) / static_cast<float>(total);
+	}
+
+	void AssetManager::Finish( AssetGroup group, std::function<void()> publish )
+	{
+		{
+			std::lock_guard<std::mutex> lock( finishedMutex );
+			finished.push_back( { group, std::move( publish ) } );
+		}
+		assetFinished.notify_all();
+	}
+}
\ No newline at end of file
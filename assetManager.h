@@ -0,0 +1,89 @@
+#pragma once
+
+#include "surface.h"
+#include "jobSystem.h"
+
+#include <array>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Using an Audio library from Jeremiah van Oosten: https://github.com/jpvanoosten/Audio
+#include <Audio/Synth.hpp>
+#include <Audio/VoicePool.hpp>
+
+namespace Tmpl8 {
+
+	/* Assets are grouped by the first screen that needs them */
+	enum class AssetGroup
+	{
+		MENU, // everything needed to draw and use the main menu
+		GAME, // everything else that is loaded at startup
+		STREAMED, // loaded on demand, see SpriteCache
+		COUNT
+	};
+
+	/* Decodes images and sounds as background jobs */
+	/* Loaded assets are only handed to the game on the main thread, in Update() */
+	class AssetManager
+	{
+	public:
+		explicit AssetManager( JobSystem& jobSystem );
+
+		/* Waits for assets that are still being decoded */
+		~AssetManager();
+
+		AssetManager( const AssetManager& ) = delete;
+		AssetManager& operator=( const AssetManager& ) = delete;
+
+		/* Queues an image to be decoded into a sprite, target is set once it is published */
+		std::shared_future<std::shared_ptr<Sprite>> LoadSprite( std::shared_ptr<Sprite>& target, const char* file,
+																unsigned int frames, AssetGroup group );
+		/* Queues a sound to be decoded into a pool of voiceCount voices, target is set once it is published */
+		std::shared_future<void> LoadSound( Audio::VoicePool& target, const char* file, unsigned int voiceCount, int priority,
+											float volume, AssetGroup group );
+		/* Queues a sound to be generated from a preset into a pool of voiceCount voices, target is set once it is published */
+		std::shared_future<void> GenerateSound( Audio::VoicePool& target, const Audio::SynthPreset& preset, unsigned int voiceCount,
+												int priority, float volume, AssetGroup group );
+
+		/* Publishes every asset that finished decoding since the last call */
+		/* Must be called from the main thread */
+		void Update();
+		/* Blocks until every asset in the group has been published */
+		void Wait( AssetGroup group );
+
+		[[nodiscard]] bool IsReady( AssetGroup group ) const;
+		/* Returns the fraction (0.0f - 1.0f) of the group's assets that have been published */
+		[[nodiscard]] float GetProgress( AssetGroup group ) const;
+		/* Returns the fraction (0.0f - 1.0f) of all assets that have been published */
+		[[nodiscard]] float GetProgress() const;
+
+	private:
+		/* Called on a worker once an asset is decoded */
+		void Finish( AssetGroup group, std::function<void()> publish );
+
+		struct FinishedAsset
+		{
+			AssetGroup group;
+			/* Moves the decoded asset into its target */
+			std::function<void()> publish;
+		};
+
+		JobSystem& jobSystem;
+		/* One per queued asset that may still be decoding, so the destructor can wait for them */
+		/* Finished ones are removed in Update() */
+		std::vector<JobHandle> jobs;
+
+		std::mutex finishedMutex;
+		std::condition_variable assetFinished;
+		std::vector<FinishedAsset> finished;
+
+		/* Only accessed on the main thread */
+		std::array<unsigned int, static_cast<size_t>(AssetGroup::COUNT)> queued{};
+		std::array<unsigned int, static_cast<size_t>(AssetGroup::COUNT)> published{};
+	};
+}
\ No newline at end of file
@@ -0,0 +1,26 @@
+#include "chaseTarget.h"
+
+#include <cmath>
+
+namespace Tmpl8 {
+
+	void ChaseTarget::Update( vec2 _target )
+	{
+		target = _target;
+	}
+
+	vec2 ChaseTarget::Steer( vec2 pos, float speed ) const
+	{
+		/* Calculate delta X and delta Y */
+		const float dX = target.x - pos.x;
+		const float dY = target.y - pos.y;
+
+		/* Makes sure not to divide by 0 */
+		if (dX == 0.0f && dY == 0.0f) { return { 0.0f, 0.0f }; }
+
+		/* Directional speed is adjusted to move the same amount per tick/second/etc.
+		 * regardless of direction */
+		const float length = sqrtf( dX * dX + dY * dY );
+		return { (speed * dX) / length, (speed * dY) / length };
+	}
+}
\ No newline at end of file
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cmath>
+
+#include "template.h"
+
+namespace Tmpl8 {
+
+	/* The target the coals chase, shared by every coal and set once per tick */
+	/* The arena has no obstacles, so for every position the way is a straight line to the target */
+	class ChaseTarget
+	{
+	public:
+		/* Sets the target, call once per tick before the coals move */
+		void Update( vec2 target );
+		/* Returns the velocity of something at pos moving towards the target at the given speed */
+		/* Returns (0, 0) when pos is exactly on the target */
+		[[nodiscard]] vec2 Steer( vec2 pos, float speed ) const;
+
+	private:
+		vec2 target{ 0.0f, 0.0f };
+	};
+}
\ No newline at end of file
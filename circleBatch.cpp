@@ -0,0 +1,159 @@
+#include "circleBatch.h"
+
+#include <cstring>
+#include <emmintrin.h>
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/* The AVX2 kernel is only called when the CPU supports it, the rest of the game doesn't need it */
+#if defined(__GNUC__) || defined(__clang__)
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define TARGET_AVX2
+#endif
+
+namespace Tmpl8 {
+
+	void CircleBatch::Clear()
+	{
+		x.clear();
+		y.clear();
+		r.clear();
+	}
+
+	void CircleBatch::Add( Circle circle )
+	{
+		x.push_back( circle.pos.x );
+		y.push_back( circle.pos.y );
+		r.push_back( circle.r );
+	}
+
+	namespace {
+
+		using Kernel = void (*)( Circle circle, const float* x, const float* y, const float* r, size_t count, uint32_t* mask );
+
+		/* Tests one circle, used for the entries that don't fill a whole vector */
+		bool Overlaps( Circle circle, float x, float y, const float* r )
+		{
+			const float dX = x - circle.pos.x;
+			const float dY = y - circle.pos.y;
+			const float squaredDist = dX * dX + dY * dY;
+
+			if (!r) { return squaredDist < circle.r * circle.r; }
+			if (*r <= 0.0f) { return false; }
+			return squaredDist < (*r + circle.r) * (*r + circle.r);
+		}
+
+		void OverlapMaskSSE2( Circle circle, const float* x, const float* y, const float* r, size_t count, uint32_t* mask )
+		{
+			const __m128 cx = _mm_set1_ps( circle.pos.x );
+			const __m128 cy = _mm_set1_ps( circle.pos.y );
+			const __m128 cr = _mm_set1_ps( circle.r );
+			const __m128 squaredRange = _mm_set1_ps( circle.r * circle.r );
+			const __m128 zero = _mm_setzero_ps();
+
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m128 dX = _mm_sub_ps( _mm_loadu_ps( x + i ), cx );
+				const __m128 dY = _mm_sub_ps( _mm_loadu_ps( y + i ), cy );
+				const __m128 squaredDist = _mm_add_ps( _mm_mul_ps( dX, dX ), _mm_mul_ps( dY, dY ) );
+
+				__m128 hit;
+				if (r)
+				{
+					const __m128 radius = _mm_loadu_ps( r + i );
+					const __m128 sum = _mm_add_ps( radius, cr );
+					hit = _mm_and_ps( _mm_cmplt_ps( squaredDist, _mm_mul_ps( sum, sum ) ), _mm_cmpgt_ps( radius, zero ) );
+				}
+				else
+				{
+					hit = _mm_cmplt_ps( squaredDist, squaredRange );
+				}
+
+				mask[i / 32] |= static_cast<uint32_t>(_mm_movemask_ps( hit )) << (i % 32);
+			}
+
+			for (; i < count; ++i)
+			{
+				if (Overlaps( circle, x[i], y[i], r ? r + i : nullptr )) { mask[i / 32] |= 1u << (i % 32); }
+			}
+		}
+
+		TARGET_AVX2
+		void OverlapMaskAVX2( Circle circle, const float* x, const float* y, const float* r, size_t count, uint32_t* mask )
+		{
+			const __m256 cx = _mm256_set1_ps( circle.pos.x );
+			const __m256 cy = _mm256_set1_ps( circle.pos.y );
+			const __m256 cr = _mm256_set1_ps( circle.r );
+			const __m256 squaredRange = _mm256_set1_ps( circle.r * circle.r );
+			const __m256 zero = _mm256_setzero_ps();
+
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m256 dX = _mm256_sub_ps( _mm256_loadu_ps( x + i ), cx );
+				const __m256 dY = _mm256_sub_ps( _mm256_loadu_ps( y + i ), cy );
+				const __m256 squaredDist = _mm256_add_ps( _mm256_mul_ps( dX, dX ), _mm256_mul_ps( dY, dY ) );
+
+				__m256 hit;
+				if (r)
+				{
+					const __m256 radius = _mm256_loadu_ps( r + i );
+					const __m256 sum = _mm256_add_ps( radius, cr );
+					hit = _mm256_and_ps( _mm256_cmp_ps( squaredDist, _mm256_mul_ps( sum, sum ), _CMP_LT_OQ ),
+										 _mm256_cmp_ps( radius, zero, _CMP_GT_OQ ) );
+				}
+				else
+				{
+					hit = _mm256_cmp_ps( squaredDist, squaredRange, _CMP_LT_OQ );
+				}
+
+				mask[i / 32] |= static_cast<uint32_t>(_mm256_movemask_ps( hit )) << (i % 32);
+			}
+
+			for (; i < count; ++i)
+			{
+				if (Overlaps( circle, x[i], y[i], r ? r + i : nullptr )) { mask[i / 32] |= 1u << (i % 32); }
+			}
+		}
+
+		bool HasAVX2()
+		{
+#ifdef _MSC_VER
+			int info[4];
+			__cpuid( info, 0 );
+			if (info[0] < 7) { return false; }
+
+			/* The OS also has to save the AVX registers */
+			__cpuid( info, 1 );
+			const bool osxsave = (info[2] & (1 << 27)) != 0;
+			const bool avx = (info[2] & (1 << 28)) != 0;
+			if (!osxsave || !avx || (_xgetbv( 0 ) & 0x6) != 0x6) { return false; }
+
+			__cpuidex( info, 7, 0 );
+			return (info[1] & (1 << 5)) != 0;
+#else
+			return __builtin_cpu_supports( "avx2" );
+#endif
+		}
+
+		Kernel SelectKernel()
+		{
+			return HasAVX2() ? OverlapMaskAVX2 : OverlapMaskSSE2;
+		}
+	}
+
+	void OverlapMask( Circle circle, const float* x, const float* y, const float* r, size_t count, uint32_t* mask )
+	{
+		static const Kernel kernel = SelectKernel();
+
+		std::memset( mask, 0, ((count + 31) / 32) * sizeof( uint32_t ) );
+		/* Same as DoCirclesOverlap(), a circle without a radius overlaps nothing */
+		if (r && circle.r <= 0.0f) { return; }
+
+		kernel( circle, x, y, r, count, mask );
+	}
+}
\ No newline at end of file
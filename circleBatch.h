@@ -0,0 +1,74 @@
+#pragma once
+
+#include "entity.h"
+#include "template.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Tmpl8 {
+
+	/* Circles stored as separate x, y and r arrays, for the overlap kernels below */
+	struct CircleBatch
+	{
+		void Clear();
+		void Add( Circle circle );
+		/* Adds a point, only to be used with the range functions */
+		void Add( vec2 point ) { Add( { point, 0.0f } ); }
+		[[nodiscard]] size_t Size() const { return x.size(); }
+
+		std::vector<float> x, y;
+		std::vector<float> r;
+	};
+
+	/* Sets bit i % 32 of mask[i / 32] when the circle overlaps circle i, the same test as DoCirclesOverlap() */
+	/* When r is nullptr, bit i is set when point i is closer than circle.r to circle.pos, like */
+	/* comparing GetSquaredDist() to circle.r squared */
+	/* mask needs (count + 31) / 32 words, uses AVX2 when the CPU supports it and SSE2 otherwise */
+	void OverlapMask( Circle circle, const float* x, const float* y, const float* r, size_t count, uint32_t* mask );
+
+	/* Calls visit( index ) for every circle in the batch the circle overlaps, lowest index first */
+	template <typename Visit>
+	void ForEachOverlap( Circle circle, const CircleBatch& batch, Visit visit );
+	/* Calls visit( index ) for every point in the batch closer than range to pos, lowest index first */
+	template <typename Visit>
+	void ForEachInRange( vec2 pos, float range, const CircleBatch& points, Visit visit );
+
+	/* Used by ForEachOverlap() and ForEachInRange(), points ignores the batch's radii */
+	template <typename Visit>
+	void ForEachHit( Circle circle, const CircleBatch& batch, bool points, Visit visit )
+	{
+		/* The mask is built a chunk at a time, so it fits on the stack */
+		constexpr size_t chunkSize{ 256 };
+		uint32_t mask[chunkSize / 32];
+
+		for (size_t first = 0; first < batch.Size(); first += chunkSize)
+		{
+			const size_t count = (batch.Size() - first < chunkSize) ? batch.Size() - first : chunkSize;
+			OverlapMask( circle, batch.x.data() + first, batch.y.data() + first,
+				points ? nullptr : batch.r.data() + first, count, mask );
+
+			for (size_t word = 0; word < (count + 31) / 32; ++word)
+			{
+				if (mask[word] == 0) { continue; }
+				for (size_t bit = 0; bit < 32; ++bit)
+				{
+					if ((mask[word] >> bit) & 1) { visit( first + word * 32 + bit ); }
+				}
+			}
+		}
+	}
+
+	template <typename Visit>
+	void ForEachOverlap( Circle circle, const CircleBatch& batch, Visit visit )
+	{
+		ForEachHit( circle, batch, false, visit );
+	}
+
+	template <typename Visit>
+	void ForEachInRange( vec2 pos, float range, const CircleBatch& points, Visit visit )
+	{
+		ForEachHit( { pos, range }, points, true, visit );
+	}
+}
\ No newline at end of file
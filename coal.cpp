@@ -1,18 +1,36 @@
 #include "coal.h"
 
 #include "game.h"
+#include "mathFunctions.h"
 
 namespace Tmpl8 {
 
-	Coal::Coal( std::shared_ptr<Sprite> _sprite, vec2 _centerPos,
+	Coal::Coal( SpriteId _sprite, vec2 _centerPos,
 				float _hitBoxRadius, float _speed )
-		: Entity( std::move(_sprite), _centerPos, _hitBoxRadius, _speed)
+		: Entity( _sprite, _centerPos, _hitBoxRadius, _speed)
 	{}
 
-	void Coal::DrawShadow(Surface* screen)
+	vec2 Coal::PursuePlayer( const Game& game ) const
 	{
-		sprite->SetFrame( frame );
-		Entity::DrawShadow( screen );
+		return game.GetChaseTarget().Steer( GetPos(), speed );
+	}
+
+	void Coal::Steer( float deltaTime, const Game& game )
+	{
+		if (!hasSteered || game.GetAiScheduler().ShouldUpdate( id, GetPos() ))
+		{
+			/* Move towards the player */
+			steering = PursuePlayer( game );
+			// Setting the direction, only used for drawing the direction hit box line
+			SetDir( steering );
+			/* Adjust position based on separation (steering behavior) */
+			steering += ApplySeparation( deltaTime, game );
+			hasSteered = true;
+		}
+
+		SetPos( GetPos() + (steering * deltaTime) );
+		/* Clamped right after moving, so the coals that move after this one separate from where it really is */
+		if (motion) { ClampRowToWalls( *motion, motionRow, game.GetWalls() ); }
 	}
 
 	vec2 Coal::ApplySeparation( float deltaTime, const Game& game )
@@ -24,36 +42,29 @@ namespace Tmpl8 {
 		vec2 averageDist{ 0.0f, 0.0f };
 		vec2 move{ 0.0f, 0.0f };
 
-		/* Go over basic coals */
-		for (auto& c : game.GetCoalBasicVec())
-		{
-			/* Don't go over 'this' */
-			if (c.GetId() != id)
-			{
-				/* Make sure the target 'c' is within distance */
-				if (centerPos.dist( c.GetPos() ) <= separationRadius)
-				{
-					coalCount++;
-					averageDist.x += centerPos.distToPointX( c.GetPos().x );
-					averageDist.y += centerPos.distToPointY( c.GetPos().y );
-				}
-			}
-		}
-		/* Go over bomb coals */
-		for (auto& c : game.GetCoalBombVec())
+		const vec2 pos = GetPos();
+		const auto& basicCoals = game.GetCoalBasicPool();
+		const auto& bombCoals = game.GetCoalBombPool();
+		const float maxSquaredDist = separationRadius * separationRadius;
+
+		/* Only go over the coals in nearby cells of the separation grid */
+		/* Indices below the amount of basic coals are basic coals, the rest are bomb coals */
+		game.GetSeparationGrid().Query( { pos, separationRadius + separationDrift }, [&]( size_t i )
 		{
+			if (coalCount >= maxSeparationNeighbours) { return; }
+
+			const Coal& c = (i < basicCoals.Size()) ? static_cast<const Coal&>(basicCoals[i])
+													: static_cast<const Coal&>(bombCoals[i - basicCoals.Size()]);
+
 			/* Don't go over 'this' */
-			if (c.GetId() != id)
+			/* Make sure the target 'c' is within distance, using its current position */
+			if (c.GetId() != id && GetSquaredDist( pos, c.GetPos() ) <= maxSquaredDist)
 			{
-				/* Make sure the target 'c' is within distance */
-				if (centerPos.dist( c.GetPos() ) <= separationRadius)
-				{
-					coalCount++;
-					averageDist.x += centerPos.distToPointX( c.GetPos().x );
-					averageDist.y += centerPos.distToPointY( c.GetPos().y );
-				}
+				coalCount++;
+				averageDist.x += pos.distToPointX( c.GetPos().x );
+				averageDist.y += pos.distToPointY( c.GetPos().y );
 			}
-		}
+		} );
 
 		if (coalCount)
 		{
@@ -67,7 +78,7 @@ namespace Tmpl8 {
 		}
 
 		const CoalGold& gold = game.GetGoldCoal();
-		vec2 toGold = centerPos - gold.GetPos();
+		vec2 toGold = pos - gold.GetPos();
 
 		/* If the gold coal is active and */
 		/* if 'this' makes contact with the gold coal */
@@ -80,27 +91,4 @@ namespace Tmpl8 {
 		}
 		return move;
 	}
-
-	void Coal::CheckWallCollision()
-	{
-		/* Side wall collision check and correction */
-		if (centerPos.x - hitBoxRadius < backgroundOffset)
-		{
-			centerPos.x = backgroundOffset + hitBoxRadius;
-		}
-		else if ((centerPos.x + hitBoxRadius - 1) >= (ScreenWidth - backgroundOffset))
-		{
-			centerPos.x = ScreenWidth - backgroundOffset - hitBoxRadius;
-		}
-
-		/* Bottom and top wall collision check and correction */
-		if (centerPos.y - hitBoxRadius < backgroundOffset)
-		{
-			centerPos.y = backgroundOffset + hitBoxRadius;
-		}
-		else if ((centerPos.y + hitBoxRadius - 1) >= (ScreenHeight - backgroundOffset))
-		{
-			centerPos.y = ScreenHeight - backgroundOffset - hitBoxRadius;
-		}
-	}
 }
\ No newline at end of file
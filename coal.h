@@ -8,22 +8,29 @@ namespace Tmpl8 {
 	class Game;
 	class Coal : public Entity
 	{
-	public:
-		void DrawShadow( Surface* screen ) override;
-
 	protected:
 
 		/* Constructor */
-		Coal( std::shared_ptr<Sprite> sprite, vec2 centerPos,
+		Coal( SpriteId sprite, vec2 centerPos,
 			float hitBoxRadius, float speed );
 
+		/* Returns the velocity towards the player, steered by the game's chase target */
+		[[nodiscard]] vec2 PursuePlayer( const Game& game ) const;
 		vec2 ApplySeparation( float deltaTime, const Game& game );
-		void CheckWallCollision();
+		/* Moves the coal, recalculating its steering only when the AI scheduler allows it */
+		/* In between, the coal keeps moving with its last steering */
+		void Steer( float deltaTime, const Game& game );
 
 		/* Variables */
-		unsigned int frame{ 0 };
+		/* Pursuit plus separation, from the last tick the coal was scheduled to steer */
+		vec2 steering{ 0.0f, 0.0f };
+		bool hasSteered{ false };
 		static constexpr float separationPower{ 500.0f };
 		static constexpr float separationRadius{ 50.0f };
 		static constexpr float maxSeparationDist{ 50.0f };
+		/* How far a coal can move in a tick, the separation grid is built before the coals move */
+		static constexpr float separationDrift{ 32.0f };
+		/* At most this many neighbours are taken into account, keeps large swarms cheap */
+		static constexpr int maxSeparationNeighbours{ 16 };
 	};
 }
\ No newline at end of file
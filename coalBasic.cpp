@@ -5,9 +5,9 @@
 
 namespace Tmpl8 {
 
-	CoalBasic::CoalBasic( std::shared_ptr<Sprite> _sprite, vec2 _centerPos,
+	CoalBasic::CoalBasic( SpriteId _sprite, vec2 _centerPos,
 						float _hitBoxRadius, float _speed )
-		: Coal( std::move( _sprite ), _centerPos, _hitBoxRadius, _speed )
+		: Coal( _sprite, _centerPos, _hitBoxRadius, _speed )
 	{}
 
 	void CoalBasic::Update(float deltaTime, const Game& game)
@@ -22,84 +22,59 @@ namespace Tmpl8 {
 				despawned = true;
 			}
 		}
-		/* Handle despawn mechanic if necessary */
+		/* A despawning coal only steps its frames, in StepFrame() */
 		else if (despawn)
 		{
-			/* Apply logic to the frame system */
-			timeSinceFrameUpdate += deltaTime;
-
-			if (frame == 0 && (timeSinceFrameUpdate >= timeBetweenFrameUpdates))
-			{
-				despawned = true;
-			}
-			else if (timeSinceFrameUpdate >= timeBetweenFrameUpdates)
-			{
-				--frame;
-				timeSinceFrameUpdate = 0.0f;
-			}
-			
+			return;
 		}
 		/* Only start applying movement logic once */
 		/* the spawning animation has ended */
 		else if (finishedSpawning)
 		{
-			vec2 move{ 0.0f, 0.0f };
-
-			/* Calculate delta X and delta Y */
-			const float dX = game.GetPlayerPos().x - centerPos.x;
-			const float dY = game.GetPlayerPos().y - centerPos.y;
-
-			/* Makes sure not to divide by 0 */
-			if (dX != 0.0f || dY != 0.0f)
-			{
-				/* Directional speed is adjusted to move the same amount per tick/second/etc.
-				 * regardless of direction */
-				const float moveX = (speed * dX) / sqrtf( dX * dX + dY * dY );
-				const float moveY = (speed * dY) / sqrtf( dX * dX + dY * dY );
-
-				move.x += moveX;
-				move.y += moveY;
-			}
-			// Setting the direction, only used for drawing the direction hit box line
-			dir = move;
-			/* Adjust position based on separation (steering behavior) */
-			move += ApplySeparation( deltaTime, game );
-
-			centerPos += (move * deltaTime);
+			Steer( deltaTime, game );
 		}
-		else
+		/* Draw() has gone to the last spawning frame */
+		else if (frame == (GetSprite()->Frames() - 1 - deathFrames))
 		{
-			/* Apply logic to the frame system */
-			timeSinceFrameUpdate += deltaTime;
-			if (frame == (sprite->Frames() - 1 - deathFrames))
-			{
-				updateFrame = false;
-				finishedSpawning = true;
-				invincible = false;
-			}
-			else if (timeSinceFrameUpdate >= timeBetweenFrameUpdates)
+			updateFrame = false;
+			finishedSpawning = true;
+			invincible = false;
+		}
+	}
+
+	bool CoalBasic::StepFrame()
+	{
+		if (despawn)
+		{
+			if (frame == 0)
 			{
-				updateFrame = true;
-				timeSinceFrameUpdate = 0.0f;
+				despawned = true;
+				return false;
 			}
+
+			--frame;
+			return true;
 		}
 
-		/* Always check collision with the wall */
-		CheckWallCollision();
+		if (finishedSpawning) { return false; }
+
+		/* The frame goes up in Draw(), keep stepping until Update() sees the last spawning frame */
+		if (frame != (GetSprite()->Frames() - 1 - deathFrames)) { updateFrame = true; }
+		return true;
 	}
 
 	void CoalBasic::Draw(Surface* screen)
 	{
+		const vec2 pos = GetPos();
+
 		if (dead)
 		{
 			if (timeDead < 0.01f)
 			{
-				sprite->SetFrame( 5 );
-
-				sprite->DrawInColor( screen,
-					static_cast<int>(centerPos.x - halfWidth),
-					static_cast<int>(centerPos.y - halfHeight),
-					hitColor );
+				GetSprite()->DrawInColor( screen,
+					static_cast<int>(pos.x - halfWidth),
+					static_cast<int>(pos.y - halfHeight),
+					5, hitColor );
 
 				return;
 			}
@@ -115,29 +90,28 @@ namespace Tmpl8 {
 		/* Update the frame when necessary */
 		else if (updateFrame)
 		{
-			if (++frame >= sprite->Frames())
+			if (++frame >= GetSprite()->Frames())
 			{
-				frame = sprite->Frames();
+				frame = GetSprite()->Frames();
 			}
 			updateFrame = false;
 		}
 
 		/* Draw the sprite */
-		sprite->SetFrame( frame );
-		if (frame > sprite->Frames() - deathFrames - 3)
+		if (frame > GetSprite()->Frames() - deathFrames - 3)
 		{
-			sprite->DrawWithShadow( screen,
-				static_cast<int>(centerPos.x - halfWidth),
-				static_cast<int>(centerPos.y - halfHeight),
-				shadowOffset, shadowOffset, shadowFadeLength,
+			GetSprite()->DrawWithShadow( screen,
+				static_cast<int>(pos.x - halfWidth),
+				static_cast<int>(pos.y - halfHeight),
+				frame, shadowOffset, shadowOffset, shadowFadeLength,
 				0x000000, 0.5f );
 		}
 		else /* Draw the coal a bit darker while spawning (as it comes from underground) */
 		{
-			sprite->DrawInBlendedColor( screen,
-				static_cast<int>(centerPos.x - halfWidth),
-				static_cast<int>(centerPos.y - halfHeight),
-				0x000000, 
+			GetSprite()->DrawInBlendedColor( screen,
+				static_cast<int>(pos.x - halfWidth),
+				static_cast<int>(pos.y - halfHeight),
+				frame, 0x000000, 
 				0.1f,
 				shadowOffset, shadowOffset, shadowFadeLength, 0x000000, 0.5f );
 		}
@@ -11,14 +11,18 @@ namespace Tmpl8 {
 	{
 	public:
 		/* Constructor*/
-		CoalBasic( std::shared_ptr<Sprite> sprite, vec2 centerPos,
+		CoalBasic( SpriteId sprite, vec2 centerPos,
 				float hitBoxRadius, float speed );
 
 		void Update(float deltaTime) override { /* UNIMPLEMENTED */ }
 		void Update( float deltaTime, const Game& game );
 		void Draw(Surface* screen) override;
 
+		/* Only a coal that is still spawning despawns, its frame timer is still going then */
 		void Despawn() { despawn = true; updateFrame = false; }
+		/* Steps the spawning or despawning animation, the game's timers call it every timeBetweenFrameUpdates */
+		/* Returns false once there is no frame left to step */
+		bool StepFrame();
 		void SetDead() { dead = true; timeDead = 0.0f; invincible = true; }
 		[[nodiscard]] bool IsDead() const { return dead; }
 		[[nodiscard]] bool FinishedSpawning() const { return finishedSpawning; }
@@ -26,6 +30,8 @@ namespace Tmpl8 {
 		[[nodiscard]] bool IsInvincible() const { return invincible; }
 		[[nodiscard]] bool IsDespawned() const { return despawned; }
 
+		static constexpr float timeBetweenFrameUpdates{ 0.2f };
+
 	private:
 		/* The coal is invincible until it's spawning animation finishes */
 		bool invincible{ true };
@@ -39,8 +45,6 @@ namespace Tmpl8 {
 		bool despawned{ false };
 		bool updateFrame{ false };
 		bool finishedSpawning{ false };
-		float timeSinceFrameUpdate{ 0.0f };
-		static constexpr  float timeBetweenFrameUpdates{ 0.2f };
 		/* Amount of frames the death animation has */
 		static constexpr int deathFrames{ 2 };
 	};
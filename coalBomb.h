@@ -11,7 +11,7 @@ namespace Tmpl8 {
 	{
 	public:
 		/* Constructor */
-		CoalBomb( std::shared_ptr<Sprite> sprite, vec2 centerPos,
+		CoalBomb( SpriteId sprite, vec2 centerPos,
 				float hitBoxRadius, float speed );
 
 		void Update( float deltaTime ) override { /* UNIMPLEMENTED */ }
@@ -19,12 +19,18 @@ namespace Tmpl8 {
 		void Draw( Surface* screen ) override;
 		void DrawHitBox(Surface* screen) const override;
 
+		/* Only a coal that is still spawning despawns, its frame timer is still going then */
 		void Despawn() { despawn = true; updateFrame = false; }
+		/* Steps the spawning or despawning animation, the game's timers call it every timeBetweenFrameUpdates */
+		/* Returns false once there is no frame left to step */
+		bool StepFrame();
 		[[nodiscard]] bool FinishedSpawning() const { return finishedSpawning; }
 		[[nodiscard]] bool IsDespawning() const { return despawn; }
 		[[nodiscard]] bool IsInvincible() const { return invincible; }
 		[[nodiscard]] bool IsDespawned() const { return despawned; }
 
+		static constexpr float timeBetweenFrameUpdates{ 0.2f };
+
 	private:
 		/* The coal is invincible until it's spawning animation finishes */
 		bool invincible{ true };
@@ -34,8 +40,6 @@ namespace Tmpl8 {
 		bool despawned{ false };
 		bool updateFrame{ false };
 		bool finishedSpawning{ false };
-		float timeSinceFrameUpdate{ 0.0f };
-		static constexpr  float timeBetweenFrameUpdates{ 0.2f };
 		
 		static constexpr float explodeDist{ 32.0f };
 	};
@@ -4,9 +4,9 @@
 
 namespace Tmpl8 {
 
-	CoalGold::CoalGold( std::shared_ptr<Sprite> _sprite, vec2 _centerPos,
+	CoalGold::CoalGold( SpriteId _sprite, vec2 _centerPos,
 					float _hitBoxRadius, float _speed )
-		: Coal( std::move( _sprite ), _centerPos, _hitBoxRadius, _speed )
+		: Coal( _sprite, _centerPos, _hitBoxRadius, _speed )
 	{
 		speed *= speedMultiplier;
 
@@ -81,10 +81,10 @@ namespace Tmpl8 {
 
 	void CoalGold::Draw(Surface* screen)
 	{
-		sprite->DrawWithShadow( screen,
+		GetSprite()->DrawWithShadow( screen,
 			static_cast<int>(centerPos.x - halfWidth),
 			static_cast<int>(centerPos.y - halfHeight),
-			shadowOffset, shadowOffset, shadowFadeLength,
+			frame, shadowOffset, shadowOffset, shadowFadeLength,
 			0x000000, 0.5f );
 	}
 
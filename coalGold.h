@@ -17,7 +17,7 @@ namespace Tmpl8 {
 	{
 	public:
 		/* Constructor*/
-		CoalGold( std::shared_ptr<Sprite> sprite, vec2 centerPos,
+		CoalGold( SpriteId sprite, vec2 centerPos,
 				float hitBoxRadius, float speed );
 
 		void Update( float deltaTime ) override;
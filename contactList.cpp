@@ -0,0 +1,30 @@
+#include "contactList.h"
+
+#include <algorithm>
+
+namespace Tmpl8 {
+
+	void ContactList::Begin( ContactPair _pair, size_t countA )
+	{
+		pair = _pair;
+		contacts.clear();
+		start.assign( countA + 1, 0 );
+	}
+
+	void ContactList::End()
+	{
+		std::sort( contacts.begin(), contacts.end(), []( const Contact& c1, const Contact& c2 )
+		{
+			return (c1.a != c2.a) ? (c1.a < c2.a) : (c1.b < c2.b);
+		} );
+
+		/* Count the contacts per a, then turn the counts into offsets */
+		for (const Contact& contact : contacts) { start[contact.a + 1]++; }
+		for (size_t a = 1; a < start.size(); ++a) { start[a] += start[a - 1]; }
+	}
+
+	ContactList::Range ContactList::Of( size_t a ) const
+	{
+		return { contacts.data() + start[a], contacts.data() + start[a + 1] };
+	}
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Tmpl8 {
+
+	/* The types of entities a contact is between, 'a' is the first type and 'b' the second */
+	/* The player and the gold coal are single entities, their index is always 0 */
+	enum class ContactPair
+	{
+		FIREBALL_FIREBALL,
+		FIREBALL_FLAME,
+		FIREBALL_PLAYER,
+		FIREBALL_BOMB,
+		FIREBALL_BASIC,
+		FIREBALL_GOLD,
+		BOMB_PLAYER,
+		BOMB_FLAME,
+		BASIC_PLAYER,
+		BASIC_FLAME,
+		GOLD_FLAME,
+		EXPLOSION_FLAME,
+		EXPLOSION_BOMB,
+		EXPLOSION_BASIC,
+		EXPLOSION_GOLD,
+		EXPLOSION_PLAYER,
+		COUNT
+	};
+
+	/* Two overlapping entities, a and b are indices in their pools */
+	struct Contact
+	{
+		ContactPair pair;
+		uint32_t a;
+		uint32_t b;
+	};
+
+	/* The contacts of one ContactPair, found during collision detection */
+	/* Sorted by a and then b, so the resolver goes over them in the same order as the old loops did */
+	class ContactList
+	{
+	public:
+		/* The contacts of a single entity, lowest b first */
+		struct Range
+		{
+			[[nodiscard]] const Contact* begin() const { return first; }
+			[[nodiscard]] const Contact* end() const { return last; }
+			[[nodiscard]] bool Empty() const { return first == last; }
+
+			const Contact* first;
+			const Contact* last;
+		};
+
+		/* Removes the previous contacts, the memory is kept */
+		void Begin( ContactPair pair, size_t countA );
+		/* Contacts can be added in any order */
+		void Add( size_t a, size_t b ) { contacts.push_back( { pair, static_cast<uint32_t>(a), static_cast<uint32_t>(b) } ); }
+		/* Sorts the contacts, call after the last Add() and before Of() */
+		void End();
+
+		/* Returns the contacts of entity a, a must be below the countA given to Begin() */
+		[[nodiscard]] Range Of( size_t a ) const;
+		[[nodiscard]] size_t Size() const { return contacts.size(); }
+
+	private:
+		ContactPair pair{ ContactPair::COUNT };
+		std::vector<Contact> contacts;
+		/* The contacts of a are contacts[start[a]] up to contacts[start[a + 1]] */
+		std::vector<uint32_t> start;
+	};
+}
\ No newline at end of file
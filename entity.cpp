@@ -4,15 +4,18 @@
 
 namespace Tmpl8	{
 
-	Entity::Entity( std::shared_ptr<Sprite> _sprite, vec2 _centerPos, 
+	Entity::Entity( SpriteId _sprite, vec2 _centerPos, 
 					float _hitBoxRadius, float _speed )
-		: sprite( std::move(_sprite) )
+		: sprite( _sprite )
 		, centerPos( _centerPos )
 		, hitBoxRadius( _hitBoxRadius )
 		, speed( _speed )
 	{
-		halfWidth = static_cast<float>(sprite->GetWidth()) * 0.5f;
-		halfHeight = static_cast<float>(sprite->GetHeight()) * 0.5f;
+		if (const Sprite* s = GetSprite())
+		{
+			halfWidth = static_cast<float>(s->GetWidth()) * 0.5f;
+			halfHeight = static_cast<float>(s->GetHeight()) * 0.5f;
+		}
 
 		/* Sets a unique ID for each entity */
 		id = next_id;
@@ -20,20 +23,37 @@ namespace Tmpl8	{
 		dirLineLength = hitBoxRadius * 2;
 	}
 
+	void Entity::BindMotion( MotionBatch* batch, uint32_t row )
+	{
+		batch->Set( row, centerPos, dir, speed, hitBoxRadius );
+		motion = batch;
+		motionRow = row;
+	}
+
+	void Entity::SetSprite( SpriteId _sprite )
+	{
+		sprite = _sprite;
+		halfWidth = static_cast<float>(GetSprite()->GetWidth()) * 0.5f;
+		halfHeight = static_cast<float>(GetSprite()->GetHeight()) * 0.5f;
+	}
+
 	void Entity::Draw( Surface* screen )
 	{
-		sprite->Draw( screen,
-			static_cast<int>(centerPos.x - halfWidth),
-			static_cast<int>(centerPos.y - halfHeight) );
+		const vec2 pos = GetPos();
+		GetSprite()->Draw( screen,
+			static_cast<int>(pos.x - halfWidth),
+			static_cast<int>(pos.y - halfHeight),
+			frame );
 	}
 
 	void Entity::DrawShadow(Surface* screen)
 	{
 		/* The shadow is offset towards the bottom right */
-		sprite->DrawInColor( screen, 
-			static_cast<int>(centerPos.x - halfWidth) + 5, 
-			static_cast<int>(centerPos.y - halfHeight) + 5, 
-			0x745146 );
+		const vec2 pos = GetPos();
+		GetSprite()->DrawInColor( screen, 
+			static_cast<int>(pos.x - halfWidth) + 5, 
+			static_cast<int>(pos.y - halfHeight) + 5, 
+			frame, 0x745146 );
 	}
 
 	void Entity::DrawHitBox( Surface* screen ) const
@@ -58,10 +78,10 @@ namespace Tmpl8	{
 			i += (PI / 60.0f);
 		}
 
-		vec2 tempDir = dir;
+		vec2 tempDir = GetDir();
 		tempDir.normalize();
-		const vec2 point1 = centerPos + (tempDir * hitBoxRadius);
-		const vec2 point2 = centerPos + (tempDir * (hitBoxRadius + dirLineLength));
+		const vec2 point1 = GetPos() + (tempDir * hitBoxRadius);
+		const vec2 point2 = GetPos() + (tempDir * (hitBoxRadius + dirLineLength));
 		screen->Line(point1.x, point1.y, point2.x, point2.y, 0x00ff00);
 	}
 }
\ No newline at end of file
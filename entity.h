@@ -1,10 +1,10 @@
 #pragma once
 
+#include "motionBatch.h"
+#include "spriteRegistry.h"
 #include "surface.h"
 #include "template.h"
 
-#include <memory>
-
 namespace Tmpl8
 {
 	/* Consists of a position and a radius */
@@ -34,28 +34,45 @@ namespace Tmpl8
 		virtual void DrawHitBox( Surface* screen ) const;
 
 		[[nodiscard]] unsigned int GetId() const { return id; }
-		[[nodiscard]] vec2 GetPos() const { return centerPos; }
+		[[nodiscard]] vec2 GetPos() const { return motion ? motion->GetPos( motionRow ) : centerPos; }
+		[[nodiscard]] vec2 GetDir() const { return motion ? motion->GetDir( motionRow ) : dir; }
+		[[nodiscard]] float GetSpeed() const { return speed; }
 		[[nodiscard]] float GetHitBoxRadius() const { return hitBoxRadius; }
-		/* Returns the centerPos and hitBoxRadius as a circle */
+		/* Returns the position and hitBoxRadius as a circle */
 		/* To be used for collision */
-		[[nodiscard]] virtual Circle GetCircle() const { return { centerPos, hitBoxRadius }; }
+		[[nodiscard]] virtual Circle GetCircle() const { return { GetPos(), hitBoxRadius }; }
+		/* Used when the sprite was still being loaded when the entity was created */
+		void SetSprite( SpriteId sprite );
+		/* Moves the position and direction into row of batch, the entity reads and writes them there from now on */
+		/* Used for the entities that are moved by the kernels in motionBatch.h, the row is the entity's pool slot */
+		void BindMotion( MotionBatch* batch, uint32_t row );
 
 	protected:
 
 		/* Constructor */
-		Entity( std::shared_ptr<Sprite> sprite, vec2 centerPos,
+		Entity( SpriteId sprite, vec2 centerPos,
 				float hitBoxRadius, float speed );
 
+		[[nodiscard]] Sprite* GetSprite() const { return SpriteRegistry::Get( sprite ); }
+		void SetPos( vec2 pos ) { if (motion) { motion->SetPos( motionRow, pos ); } else { centerPos = pos; } }
+		void SetDir( vec2 _dir ) { if (motion) { motion->SetDir( motionRow, _dir ); } else { dir = _dir; } }
+
 		/* Sprite */
-		std::shared_ptr<Sprite> sprite{ nullptr };
+		SpriteId sprite{ SpriteRegistry::NONE };
+		/* The sprite's frame this entity is drawn with */
+		unsigned int frame{ 0 };
 
 		/* Variables */
 		unsigned int id{ 0 };
 		inline static unsigned int next_id{ 0 };
 		Pixel groundColor{ 0x745146 };
 
+		/* Only used while the entity isn't bound to a MotionBatch, use GetPos() and GetDir() */
 		vec2 dir{ 0.0f, 0.0f };
 		vec2 centerPos{ 0.0f, 0.0f };
+		/* The batch and row the position and direction are in, when bound */
+		MotionBatch* motion{ nullptr };
+		uint32_t motionRow{ 0 };
 		float hitBoxRadius{ 0.0f };
 		float dirLineLength{ 0.0f };
 		float speed{ 0.0f };
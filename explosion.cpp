@@ -4,40 +4,23 @@
 
 namespace Tmpl8 {
 
-	Explosion::Explosion( std::shared_ptr<Sprite> _sprite, vec2 _centerPos, 
+	Explosion::Explosion( SpriteId _sprite, vec2 _centerPos, 
 						float _hitBoxRadius, float _speed )
-		: Entity( std::move( _sprite ), _centerPos, _hitBoxRadius, _speed )
+		: Entity( _sprite, _centerPos, _hitBoxRadius, _speed )
 	{}
 
-	void Explosion::Update(float deltaTime)
+	void Explosion::NextFrame()
 	{
-		timeSinceLastFrame += deltaTime;
+		++frame;
 
-		if (timeSinceLastFrame >= timeBetweenFrames)
-		{
-			currentFrame = ++currentFrame;
-
-			/* Have the hit box radius fit the sprite's frame */
-			if		(currentFrame == 4)	{ hitBoxRadius = 16.0f; }
-			else if (currentFrame == 5)	{ hitBoxRadius = 3.0f; }
-			else if (currentFrame == 6) { hitBoxRadius = 0.0f; }
-
-			/* When past the last frame, set alive to false... */
-			/* to indicate it can be deleted */
-			if (currentFrame > sprite->Frames())
-			{
-				active = false;
-				return;
-			}
+		/* Have the hit box radius fit the sprite's frame */
+		if		(frame == 4)	{ hitBoxRadius = 16.0f; }
+		else if (frame == 5)	{ hitBoxRadius = 3.0f; }
+		else if (frame == 6) { hitBoxRadius = 0.0f; }
 
-			timeSinceLastFrame = 0.0f;
-		}
-	}
-
-	void Explosion::Draw(Surface* screen)
-	{
-		sprite->SetFrame( currentFrame );
-		Entity::Draw( screen );
+		/* When past the last frame, set alive to false... */
+		/* to indicate it can be deleted */
+		if (frame > GetSprite()->Frames()) { active = false; }
 	}
 
 	void Explosion::DrawHitBox(Surface* screen) const
@@ -9,26 +9,26 @@ namespace Tmpl8 {
 	class Explosion : public Entity
 	{
 	public:
-		Explosion( std::shared_ptr<Sprite> sprite, vec2 centerPos,
+		Explosion( SpriteId sprite, vec2 centerPos,
 				float hitBoxRadius, float speed );
 
 		Explosion( Explosion&& ) = default;
 		Explosion& operator=( Explosion&& ) = default;
 
-		void Update(float deltaTime) override;
-		void Draw(Surface* screen) override;
+		/* The frames are stepped by NextFrame(), which the game's timers call */
+		void Update(float deltaTime) override { /* UNIMPLEMENTED */ }
 		void DrawHitBox(Surface* screen) const override;
 
+		/* Goes to the next frame of the animation, the explosion is no longer active after the last one */
+		void NextFrame();
+
 		void SetActive( bool state ) { active = state; }
 		[[nodiscard]] bool IsActive() const { return active; }
 
+		static constexpr float timeBetweenFrames{ 0.1f };
+
 	private:
 
 		bool active{ true };
-
-		unsigned int currentFrame{ 0 };
-
-		float timeSinceLastFrame{ 0.0f };
-		static constexpr float timeBetweenFrames{ 0.1f };
 	};
 }
\ No newline at end of file
@@ -1,9 +1,13 @@
 #pragma once
 
 #include "Listener.hpp"
+#include "Music.hpp"
 #include "Sound.hpp"
+#include "Synth.hpp"
+#include "VoicePool.hpp"
 #include "Waveform.hpp"
 
+#include <cstdint>
 #include <filesystem>
 
 namespace Audio
@@ -11,6 +15,123 @@ namespace Audio
 class Device
 {
 public:
+    /// <summary>
+    /// The result of `benchmarkMix`.
+    /// </summary>
+    struct MixBenchmark
+    {
+        uint32_t voiceCount   = 0;    ///< The number of voices that played at once.
+        double   mixedSeconds = 0.0;  ///< The length of the audio that was mixed (in seconds).
+        double   mixTime      = 0.0;  ///< The time it took to mix the audio (in seconds).
+
+        /// <summary>
+        /// Get the time it takes to mix one second of audio.
+        /// </summary>
+        /// <returns>The time (in seconds) per mixed second.</returns>
+        double getTimePerMixedSecond() const noexcept
+        {
+            return mixedSeconds > 0.0 ? mixTime / mixedSeconds : 0.0;
+        }
+    };
+
+    /// <summary>
+    /// The result of `measureLatency`.
+    /// </summary>
+    struct LatencyMeasurement
+    {
+        uint32_t eventCount     = 0;    ///< The number of events that were measured.
+        double   outputLatency  = 0.0;  ///< The output latency of the device (in seconds), see `getOutputLatency`.
+        double   averageLatency = 0.0;  ///< The average time from an event to its sound leaving the device (in seconds).
+        double   maximumLatency = 0.0;  ///< The longest time from an event to its sound leaving the device (in seconds).
+    };
+
+    /// <summary>
+    /// The ways voices can be mixed, for `benchmarkMix`.
+    /// </summary>
+    enum class MixPath
+    {
+        Mixer,      ///< The lean mixer that plays the voices of voice pools.
+        NodeGraph,  ///< A sound per voice in the node graph of the engine, like `Sound`.
+    };
+
+    /// <summary>
+    /// Mix without an audio device, for example on hosts without a sound card.
+    /// Nothing is mixed until `mix` is called, so the caller decides the pace: from its own
+    /// clock or as fast as possible.
+    /// </summary>
+    /// <remarks>
+    /// This must be called before any other function of the device.
+    /// </remarks>
+    /// <param name="sampleRate">(optional) The sample rate to mix at. Default: 48000</param>
+    /// <param name="channels">(optional) The number of channels to mix. Default: 2</param>
+    static void setHeadless( uint32_t sampleRate = 48000, uint32_t channels = 2 );
+
+    /// <summary>
+    /// Set the size and number of the periods of the buffer of the audio device.
+    /// The audio thread mixes a period at a time, and the sound of an event can only be heard after the
+    /// periods that are already in the buffer. Smaller and fewer periods lower the latency, but the audio
+    /// stutters when the audio thread can't keep up. A value of 0 lets the backend choose.
+    /// </summary>
+    /// <remarks>
+    /// This must be called before any other function of the device. The backend may round the values.
+    /// </remarks>
+    /// <param name="periodSizeInMilliseconds">The length of a period (in milliseconds).</param>
+    /// <param name="periodCount">(optional) The number of periods in the buffer. Default: 0</param>
+    static void setPeriods( uint32_t periodSizeInMilliseconds, uint32_t periodCount = 0 );
+
+    /// <summary>
+    /// Get the output latency of the audio device: the length of its buffer, as chosen by the backend.
+    /// This is how long it takes at most for mixed audio to leave the device.
+    /// </summary>
+    /// <returns>The output latency (in seconds), or 0 in headless mode or without an audio device.</returns>
+    static double getOutputLatency();
+
+    /// <summary>
+    /// Measure the latency from a game event to its sound, by queuing events at random points in time and
+    /// timing when the audio thread picks them up. The output latency is added to that time, so the result
+    /// is the latency until the sound leaves the device (the latency of the hardware itself is not included).
+    /// Takes a few periods per event.
+    /// </summary>
+    /// <param name="eventCount">(optional) The number of events to measure. Default: 100</param>
+    /// <returns>The measured latency, or an empty result in headless mode or without an audio device.</returns>
+    static LatencyMeasurement measureLatency( uint32_t eventCount = 100 );
+
+    /// <summary>
+    /// Check if the device mixes without an audio device.
+    /// </summary>
+    /// <returns>`true` if `setHeadless` was called.</returns>
+    static bool isHeadless();
+
+    /// <summary>
+    /// Mix a number of frames. Only does something in headless mode.
+    /// </summary>
+    /// <remarks>
+    /// Queued changes to sounds are applied before mixing, so only call this from one thread at a time.
+    /// </remarks>
+    /// <param name="frameCount">The number of frames (samples per channel) to mix.</param>
+    static void mix( uint64_t frameCount );
+
+    /// <summary>
+    /// Write everything that `mix` produces to a (32-bit float) WAV file.
+    /// Only available in headless mode. An empty path closes the current file.
+    /// </summary>
+    /// <param name="filePath">The path to the WAV file to write.</param>
+    /// <returns>`true` if the file was opened.</returns>
+    static bool setWavOutput( const std::filesystem::path& filePath );
+
+    /// <summary>
+    /// Measure how long it takes to mix a number of voices that play at once.
+    /// The voices loop the sound file, the mix is written to the WAV output if one is set.
+    /// Only available in headless mode, where all mixing happens on the calling thread.
+    /// </summary>
+    /// <param name="filePath">The path to the sound file that the voices play.</param>
+    /// <param name="voiceCount">The number of voices that play at once.</param>
+    /// <param name="seconds">The length of the audio to mix (in seconds).</param>
+    /// <param name="mixPath">(optional) How the voices are mixed. Default: MixPath::Mixer</param>
+    /// <returns>The measured time, or an empty result if the device isn't headless or the file is not valid.</returns>
+    static MixBenchmark benchmarkMix( const std::filesystem::path& filePath, uint32_t voiceCount, double seconds,
+                                      MixPath mixPath = MixPath::Mixer );
+
     /// <summary>
     /// Set the master volume for the audio device. A value of 0 is silent,
     /// a value of 1 is 100% volume and a value over 1 is amplification.
@@ -45,6 +166,48 @@ public:
     /// <returns>A valid sound or empty sound if the file is not valid.</returns>
     static Sound loadMusic( const std::filesystem::path& filePath );
 
+    /// <summary>
+    /// Open a music track that is decoded on a background thread while it plays.
+    /// Unlike `loadMusic`, the audio thread never reads or decodes the file.
+    /// </summary>
+    /// <param name="filePath">The path to the music file to open.</param>
+    /// <param name="looping">(optional) Start the track again when it ends. Default: true</param>
+    /// <returns>A valid music track. The track won't play if the file is not valid.</returns>
+    static Music openMusic( const std::filesystem::path& filePath, bool looping = true );
+
+    /// <summary>
+    /// Load a sound effect that can play several times at once.
+    /// The file is decoded once and shared by every voice of the pool.
+    /// </summary>
+    /// <param name="filePath">The path to the effect file to load.</param>
+    /// <param name="voiceCount">The number of times the sound can play at once.</param>
+    /// <param name="priority">(optional) When the voice limit is reached, voices of pools with a lower priority are stopped first. Default: 0</param>
+    /// <returns>A valid voice pool. The pool won't play if the file is not valid.</returns>
+    static VoicePool loadVoicePool( const std::filesystem::path& filePath, uint32_t voiceCount, int priority = 0 );
+
+    /// <summary>
+    /// Generate a sound effect that can play several times at once.
+    /// Every version of the sound is generated once, the voices of the pool take turns playing them.
+    /// </summary>
+    /// <param name="preset">The sound to generate.</param>
+    /// <param name="voiceCount">The number of times the sound can play at once.</param>
+    /// <param name="priority">(optional) When the voice limit is reached, voices of pools with a lower priority are stopped first. Default: 0</param>
+    /// <returns>A valid voice pool.</returns>
+    static VoicePool createVoicePool( const SynthPreset& preset, uint32_t voiceCount, int priority = 0 );
+
+    /// <summary>
+    /// Set the maximum number of voices (over every voice pool) that play at once.
+    /// Sounds and music are not counted. Default: 32
+    /// </summary>
+    /// <param name="maxVoices">The maximum number of voices.</param>
+    static void setMaxVoices( uint32_t maxVoices );
+
+    /// <summary>
+    /// Get the maximum number of voices (over every voice pool) that play at once.
+    /// </summary>
+    /// <returns>The maximum number of voices.</returns>
+    static uint32_t getMaxVoices();
+
     /// <summary>
     /// Create a waveform.
     /// </summary>
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+
+namespace Audio
+{
+class MusicImpl;
+
+/// <summary>
+/// A music track that is streamed from its file.
+/// The track is decoded on a background thread into a small ring, so the memory it uses doesn't depend
+/// on the length of the track and the audio thread never waits for the file.
+/// </summary>
+class Music
+{
+public:
+    /// <summary>
+    /// Open a music track.
+    /// </summary>
+    /// <param name="filePath">The path to the music file (Ogg Vorbis, WAV, FLAC or MP3).</param>
+    /// <param name="looping">(optional) Start the track again when it ends. Default: true</param>
+    explicit Music( const std::filesystem::path& filePath, bool looping = true );
+
+    /// <summary>
+    /// Open a music track (replacing the current track if one was previously opened for this object).
+    /// </summary>
+    /// <param name="filePath">The path to the music file (Ogg Vorbis, WAV, FLAC or MP3).</param>
+    /// <param name="looping">(optional) Start the track again when it ends. Default: true</param>
+    void open( const std::filesystem::path& filePath, bool looping = true );
+
+    /// <summary>
+    /// Start playing the track where it stopped, or from the start if it ended.
+    /// </summary>
+    void play();
+
+    /// <summary>
+    /// Stop playing the track.
+    /// </summary>
+    void stop();
+
+    /// <summary>
+    /// Start playing the track with its volume fading in from silence.
+    /// If the track is still playing (for example while it fades out) it fades in from its current volume.
+    /// </summary>
+    /// <param name="milliseconds">The length of the fade.</param>
+    void fadeIn( uint64_t milliseconds );
+
+    /// <summary>
+    /// Fade the volume of the track out, and stop playing when it is silent.
+    /// Fading one track out while another fades in crossfades between them.
+    /// </summary>
+    /// <param name="milliseconds">The length of the fade.</param>
+    void fadeOut( uint64_t milliseconds );
+
+    /// <summary>
+    /// Check if the track is playing.
+    /// </summary>
+    /// <returns>`true` if the track is playing.</returns>
+    bool isPlaying() const;
+
+    /// <summary>
+    /// Set the volume of the track. A value of 0 is silent, a value of 1 is 100% volume
+    /// and a value over 1 is amplification. The fades are relative to this volume.
+    /// </summary>
+    /// <param name="volume">The volume of the track.</param>
+    void setVolume( float volume );
+
+    /// <summary>
+    /// Get the volume of the track.
+    /// </summary>
+    /// <returns>The volume of the track.</returns>
+    float getVolume() const;
+
+    Music();
+    ~Music();
+    Music( const Music& );
+    Music( Music&& ) noexcept;
+    Music& operator=( const Music& );
+    Music& operator=( Music&& ) noexcept;
+
+    /// <summary>
+    /// Allow nullptr assignment.
+    /// </summary>
+    /// <remarks>
+    /// Assigning `nullptr` will release the underlying implementation.
+    /// </remarks>
+    Music& operator=( nullptr_t ) noexcept;
+
+    /// <summary>
+    /// Allow for null checks.
+    /// </summary>
+    bool operator==( nullptr_t ) const noexcept;
+    bool operator!=( nullptr_t ) const noexcept;
+
+    /// <summary>
+    /// Explicit bool conversion allows to check for a valid object.
+    /// </summary>
+    /// <returns>`true` if this object contains a valid pointer to implementation. `false` otherwise.</returns>
+    explicit operator bool() const noexcept;
+
+protected:
+    explicit Music( std::shared_ptr<MusicImpl> impl );
+
+private:
+    std::shared_ptr<MusicImpl> impl;
+};
+}  // namespace Audio
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Waveform.hpp"
+
+#include <cstdint>
+
+namespace Audio
+{
+/// <summary>
+/// A sound effect that is generated instead of loaded from a file.
+/// A tone (mixed with noise) sweeps from the start to the end frequency, while an envelope
+/// raises it to full volume over the attack, keeps it there for the hold and fades it out over the decay.
+/// </summary>
+struct SynthPreset
+{
+    Waveform::Type type           = Waveform::Type::Square;  ///< The shape of the tone.
+    float          startFrequency = 440.0f;                  ///< The frequency of the tone at the start (in Hz).
+    float          endFrequency   = 440.0f;                  ///< The frequency at the end of the decay (in Hz), the sweep is exponential.
+    float          attack         = 0.0f;                    ///< The time to rise to full volume (in seconds).
+    float          hold           = 0.1f;                    ///< The time at full volume (in seconds).
+    float          decay          = 0.1f;                    ///< The time to fade out (in seconds).
+    float          noise          = 0.0f;                    ///< The part of the sound that is white noise, from 0 (only the tone) to 1 (only noise).
+    float          volume         = 1.0f;                    ///< The amplitude at full volume.
+
+    /// The number of versions of the sound that are generated, the voices of a pool take turns playing them.
+    uint32_t variations = 1;
+    /// The most the pitch of a version can differ from the preset, as a fraction (0.1 is up to 10% higher or lower).
+    float pitchVariation = 0.0f;
+    /// The seed of the noise and of the pitch of the versions.
+    uint32_t seed = 1;
+};
+}  // namespace Audio
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+
+namespace Audio
+{
+class VoicePoolImpl;
+struct SynthPreset;
+
+/// <summary>
+/// A sound effect that can play several times at once.
+/// The file is decoded (or the sound generated) once and every voice plays the same sample data,
+/// so playing the sound never loads or allocates anything.
+/// The voices are mixed by a lean mixer instead of the node graph of the engine, so they
+/// only have a volume and a pan: no pitch, effects or spatialization.
+/// </summary>
+class VoicePool
+{
+public:
+    /// <summary>
+    /// Load a sound effect with a number of voices.
+    /// </summary>
+    /// <param name="filePath">The path to the sound file.</param>
+    /// <param name="voiceCount">The number of times the sound can play at once.</param>
+    /// <param name="priority">(optional) When the voice limit of the device is reached, voices of pools with a lower priority are stopped first. Default: 0</param>
+    VoicePool( const std::filesystem::path& filePath, uint32_t voiceCount, int priority = 0 );
+
+    /// <summary>
+    /// Generate a sound effect with a number of voices.
+    /// </summary>
+    /// <param name="preset">The sound to generate.</param>
+    /// <param name="voiceCount">The number of times the sound can play at once.</param>
+    /// <param name="priority">(optional) When the voice limit of the device is reached, voices of pools with a lower priority are stopped first. Default: 0</param>
+    VoicePool( const SynthPreset& preset, uint32_t voiceCount, int priority = 0 );
+
+    /// <summary>
+    /// Load a sound effect with a number of voices (replacing the voices of this pool if they were previously loaded).
+    /// </summary>
+    /// <param name="filePath">The path to the sound file.</param>
+    /// <param name="voiceCount">The number of times the sound can play at once.</param>
+    /// <param name="priority">(optional) When the voice limit of the device is reached, voices of pools with a lower priority are stopped first. Default: 0</param>
+    void load( const std::filesystem::path& filePath, uint32_t voiceCount, int priority = 0 );
+
+    /// <summary>
+    /// Generate a sound effect with a number of voices (replacing the voices of this pool if they were previously loaded).
+    /// </summary>
+    /// <param name="preset">The sound to generate.</param>
+    /// <param name="voiceCount">The number of times the sound can play at once.</param>
+    /// <param name="priority">(optional) When the voice limit of the device is reached, voices of pools with a lower priority are stopped first. Default: 0</param>
+    void load( const SynthPreset& preset, uint32_t voiceCount, int priority = 0 );
+
+    /// <summary>
+    /// Play the sound on a free voice.
+    /// When every voice of this pool is playing, the voice that started first is restarted.
+    /// When the voice limit of the device is reached, the voice that started first of the pools
+    /// with the lowest priority (not higher than the priority of this pool) is stopped.
+    /// </summary>
+    /// <param name="volume">(optional) The volume of this voice, relative to the volume of the pool. Default: 1</param>
+    /// <param name="pan">(optional) The balance of this voice, -1 is left, 0 is center and 1 is right. Default: 0</param>
+    /// <returns>`true` if a voice was started, `false` if only voices with a higher priority are playing.</returns>
+    bool play( float volume = 1.0f, float pan = 0.0f );
+
+    /// <summary>
+    /// Stop every voice of this pool.
+    /// </summary>
+    void stop();
+
+    /// <summary>
+    /// Set the volume of the pool. A value of 0 is silent, a value of 1 is 100% volume
+    /// and a value over 1 is amplification.
+    /// Only voices that are started after this call are affected.
+    /// </summary>
+    /// <param name="volume">The volume of the pool.</param>
+    void setVolume( float volume );
+
+    /// <summary>
+    /// Get the volume of the pool.
+    /// </summary>
+    /// <returns>The volume of the pool.</returns>
+    float getVolume() const;
+
+    /// <summary>
+    /// Get the number of times the sound can play at once.
+    /// </summary>
+    /// <returns>The number of voices of this pool.</returns>
+    uint32_t getVoiceCount() const;
+
+    /// <summary>
+    /// Get the number of voices of this pool that are playing.
+    /// </summary>
+    /// <returns>The number of playing voices.</returns>
+    uint32_t getPlayingCount() const;
+
+    /// <summary>
+    /// Get the priority of this pool.
+    /// </summary>
+    /// <returns>The priority of this pool.</returns>
+    int getPriority() const;
+
+    VoicePool();
+    ~VoicePool();
+    VoicePool( const VoicePool& );
+    VoicePool( VoicePool&& ) noexcept;
+    VoicePool& operator=( const VoicePool& );
+    VoicePool& operator=( VoicePool&& ) noexcept;
+
+    /// <summary>
+    /// Allow nullptr assignment.
+    /// </summary>
+    /// <remarks>
+    /// Assigning `nullptr` will release the underlying implementation.
+    /// </remarks>
+    VoicePool& operator=( nullptr_t ) noexcept;
+
+    /// <summary>
+    /// Allow for null checks.
+    /// </summary>
+    bool operator==( nullptr_t ) const noexcept;
+    bool operator!=( nullptr_t ) const noexcept;
+
+    /// <summary>
+    /// Explicit bool conversion allows to check for a valid object.
+    /// </summary>
+    /// <returns>`true` if this object contains a valid pointer to implementation. `false` otherwise.</returns>
+    explicit operator bool() const noexcept;
+
+protected:
+    explicit VoicePool( std::shared_ptr<VoicePoolImpl> impl );
+
+private:
+    std::shared_ptr<VoicePoolImpl> impl;
+};
+}  // namespace Audio
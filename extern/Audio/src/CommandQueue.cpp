@@ -0,0 +1,127 @@
+#include "CommandQueue.hpp"
+
+#include <thread>
+
+using namespace Audio;
+
+CommandQueue::CommandQueue( ma_engine* pEngine, Mixer* pMixer )
+: engine { pEngine }
+, mixer { pMixer }
+{}
+
+uint64_t CommandQueue::push( const Command& command )
+{
+    uint64_t sequence = 0;
+    tryPush( command, sequence );
+    return sequence;
+}
+
+uint64_t CommandQueue::pushBlocking( const Command& command )
+{
+    uint64_t sequence = 0;
+    // The audio thread empties the ring every mix, or stops running and the command is dropped.
+    while ( !tryPush( command, sequence ) )
+        std::this_thread::yield();
+    return sequence;
+}
+
+bool CommandQueue::tryPush( const Command& command, uint64_t& sequence )
+{
+    while ( pushLock.test_and_set( std::memory_order_acquire ) )
+        std::this_thread::yield();
+
+    // Only running while the engine is initialized, otherwise the command has nothing to apply to.
+    bool queued = true;
+    if ( running.load( std::memory_order_acquire ) )
+    {
+        const uint64_t next = pushed.load( std::memory_order_relaxed );
+        if ( next - executed.load( std::memory_order_acquire ) < Capacity )
+        {
+            commands[next % Capacity] = command;
+            pushed.store( next + 1, std::memory_order_release );
+            sequence = next + 1;
+        }
+        else
+        {
+            queued = false;
+        }
+    }
+
+    pushLock.clear( std::memory_order_release );
+    return queued;
+}
+
+void CommandQueue::execute()
+{
+    const uint64_t end  = pushed.load( std::memory_order_acquire );
+    uint64_t       next = executed.load( std::memory_order_relaxed );
+
+    for ( ; next != end; ++next )
+        apply( commands[next % Capacity] );
+
+    executed.store( next, std::memory_order_release );
+}
+
+bool CommandQueue::isDone( uint64_t sequence ) const
+{
+    return executed.load( std::memory_order_acquire ) >= sequence;
+}
+
+void CommandQueue::wait( uint64_t sequence ) const
+{
+    while ( !isDone( sequence ) && running.load( std::memory_order_acquire ) )
+        std::this_thread::yield();
+}
+
+void CommandQueue::setRunning( bool _running )
+{
+    while ( pushLock.test_and_set( std::memory_order_acquire ) )
+        std::this_thread::yield();
+
+    running.store( _running, std::memory_order_release );
+
+    pushLock.clear( std::memory_order_release );
+}
+
+void CommandQueue::apply( const Command& command )
+{
+    switch ( command.type )
+    {
+    case Command::Type::Play:
+        ma_sound_start( command.sound );
+        break;
+    case Command::Type::Stop:
+        ma_sound_stop( command.sound );
+        break;
+    case Command::Type::Seek:
+        ma_sound_seek_to_pcm_frame( command.sound, command.frame );
+        break;
+    case Command::Type::SetVolume:
+        ma_sound_set_volume( command.sound, command.value );
+        break;
+    case Command::Type::SetPan:
+        ma_sound_set_pan( command.sound, command.value );
+        break;
+    case Command::Type::Fade:
+        ma_sound_set_fade_in_pcm_frames( command.sound, -1.0f, command.value, command.frame );
+        break;
+    case Command::Type::FadeFromSilence:
+        ma_sound_set_fade_in_pcm_frames( command.sound, 0.0f, command.value, command.frame );
+        break;
+    case Command::Type::SetStopTime:
+        ma_sound_set_stop_time_in_pcm_frames( command.sound, command.frame == UINT64_MAX ? UINT64_MAX : ma_engine_get_time( engine ) + command.frame );
+        break;
+    case Command::Type::SetMasterVolume:
+        ma_engine_set_volume( engine, command.value );
+        mixer->setMasterVolume( command.value );
+        break;
+    case Command::Type::StartVoice:
+        mixer->start( command.voice, command.value, command.pan );
+        break;
+    case Command::Type::StopVoice:
+        mixer->stop( command.voice );
+        break;
+    case Command::Type::Mark:
+        break;
+    }
+}
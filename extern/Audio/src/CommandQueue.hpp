@@ -0,0 +1,105 @@
+#pragma once
+
+#include "Mixer.hpp"
+#include "miniaudio.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace Audio
+{
+/// <summary>
+/// A change to a sound (or to the engine) that is applied by the audio thread.
+/// </summary>
+struct Command
+{
+    enum class Type
+    {
+        Play,
+        Stop,
+        Seek,             ///< Seek to `frame`.
+        SetVolume,        ///< Set the volume of the sound to `value`.
+        SetPan,           ///< Set the pan of the sound to `value`.
+        Fade,             ///< Fade the sound from its current fade volume to `value`, over `frame` frames.
+        FadeFromSilence,  ///< Fade the sound from silence to `value`, over `frame` frames.
+        SetStopTime,      ///< Stop the sound `frame` frames from now, or never if `frame` is UINT64_MAX.
+        SetMasterVolume,  ///< Set the volume of the engine and the mixer to `value`, `sound` is not used.
+        StartVoice,       ///< Start `voice` of the mixer with volume `value` and `pan`, `sound` is not used.
+        StopVoice,        ///< Stop `voice` of the mixer, `sound` is not used.
+        Mark,             ///< Does nothing, used to measure when the audio thread gets to a command.
+    };
+
+    Type        type  = Type::Play;
+    ma_sound*   sound = nullptr;
+    float       value = 0.0f;
+    uint64_t    frame = 0;
+    MixerVoice* voice = nullptr;
+    float       pan   = 0.0f;
+};
+
+/// <summary>
+/// Ring of commands from the game to the audio thread.
+/// The audio thread applies the commands at the start of every mix, so calls that change a
+/// sound never wait for the mixer. The ring is single-producer/single-consumer: threads that push
+/// at the same time take turns, but the audio thread never waits for them.
+/// </summary>
+class CommandQueue
+{
+public:
+    static constexpr uint32_t Capacity = 1024;
+
+    CommandQueue( ma_engine* pEngine, Mixer* pMixer );
+
+    /// <summary>
+    /// Queue a command for the audio thread.
+    /// When the audio thread isn't running the command is dropped, the engine is not initialized then.
+    /// </summary>
+    /// <returns>The sequence number of the command, or 0 if the ring is full and the command was dropped.</returns>
+    uint64_t push( const Command& command );
+
+    /// <summary>
+    /// Queue a command for the audio thread, waiting for room if the ring is full.
+    /// Used for commands that must not be dropped, like letting go of a voice before it is destroyed.
+    /// </summary>
+    /// <returns>The sequence number of the command, or 0 if the command was dropped because the audio thread isn't running.</returns>
+    uint64_t pushBlocking( const Command& command );
+
+    /// <summary>
+    /// Apply every queued command. Only called by the audio thread.
+    /// </summary>
+    void execute();
+
+    /// <summary>
+    /// Check if the command with this sequence number has been applied.
+    /// </summary>
+    bool isDone( uint64_t sequence ) const;
+
+    /// <summary>
+    /// Wait until the command with this sequence number has been applied.
+    /// Used before a sound is destroyed, so the audio thread doesn't use it afterwards.
+    /// </summary>
+    void wait( uint64_t sequence ) const;
+
+    /// <summary>
+    /// Set when the audio thread starts or stops draining the ring.
+    /// </summary>
+    void setRunning( bool running );
+
+private:
+    // Returns false if the ring is full, `sequence` stays 0 if the command was dropped.
+    bool tryPush( const Command& command, uint64_t& sequence );
+    void apply( const Command& command );
+
+    ma_engine* engine = nullptr;
+    Mixer*     mixer  = nullptr;
+
+    std::array<Command, Capacity> commands {};
+    std::atomic_flag              pushLock = ATOMIC_FLAG_INIT;
+    std::atomic<bool>             running { false };
+
+    // Both count commands since the start, the slot of a command is its count modulo the capacity.
+    alignas( 64 ) std::atomic<uint64_t> pushed { 0 };
+    alignas( 64 ) std::atomic<uint64_t> executed { 0 };
+};
+}  // namespace Audio
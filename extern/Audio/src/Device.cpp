@@ -1,15 +1,43 @@
 #include <Audio/Device.hpp>
 
+#include "CommandQueue.hpp"
 #include "ListenerImpl.hpp"
+#include "Mixer.hpp"
+#include "MusicImpl.hpp"
 #include "SoundImpl.hpp"
+#include "VoicePoolImpl.hpp"
 #include "WaveformImpl.hpp"
 
 #include "miniaudio.h"
 
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
 
 namespace Audio
 {
+// Set by `Device::setHeadless` before the device is created.
+struct HeadlessConfig
+{
+    bool     enabled    = false;
+    uint32_t sampleRate = 48000;
+    uint32_t channels   = 2;
+};
+
+static HeadlessConfig headlessConfig;
+
+// Set by `Device::setPeriods` before the device is created, 0 is the default of the backend.
+struct PeriodConfig
+{
+    uint32_t sizeInMilliseconds = 0;
+    uint32_t count              = 0;
+};
+
+static PeriodConfig periodConfig;
+
 struct MakeListener : Listener
 {
     MakeListener( std::shared_ptr<ListenerImpl> impl )
@@ -17,6 +45,13 @@ struct MakeListener : Listener
     {}
 };
 
+struct MakeMusic : Music
+{
+    MakeMusic( std::shared_ptr<MusicImpl> impl )
+    : Music( std::move( impl ) )
+    {}
+};
+
 struct MakeSound : Sound
 {
     MakeSound( std::shared_ptr<SoundImpl> impl )
@@ -24,6 +59,13 @@ struct MakeSound : Sound
     {}
 };
 
+struct MakeVoicePool : VoicePool
+{
+    MakeVoicePool( std::shared_ptr<VoicePoolImpl> impl )
+    : VoicePool( std::move( impl ) )
+    {}
+};
+
 struct MakeWaveform : Waveform
 {
     MakeWaveform( std::shared_ptr<WaveformImpl> impl )
@@ -50,10 +92,49 @@ public:
 
     Sound loadMusic( const std::filesystem::path& filePath );
 
+    Music openMusic( const std::filesystem::path& filePath, bool looping );
+
+    VoicePool loadVoicePool( const std::filesystem::path& filePath, uint32_t voiceCount, int priority );
+    VoicePool createVoicePool( const SynthPreset& preset, uint32_t voiceCount, int priority );
+
+    void     setMaxVoices( uint32_t maxVoices );
+    uint32_t getMaxVoices() const;
+
     Waveform createWaveform( Waveform::Type type, float amplitude, float frequency );
 
+    double                     getOutputLatency() const;
+    Device::LatencyMeasurement measureLatency( uint32_t eventCount );
+
+    void mix( uint64_t frameCount );
+    bool setWavOutput( const std::filesystem::path& filePath );
+
+    Device::MixBenchmark benchmarkMix( const std::filesystem::path& filePath, uint32_t voiceCount, double seconds, Device::MixPath mixPath );
+
 private:
-    ma_engine engine {};
+    // Applies the queued commands before the engine and the mixer mix the next frames.
+    static void dataCallback( ma_device* pDevice, void* pOutput, const void* pInput, ma_uint32 frameCount );
+
+    // Loops the voices for the benchmark, with a sound per voice in the node graph or with the mixer.
+    void benchmarkNodeGraph( const std::filesystem::path& filePath, uint32_t voiceCount, uint64_t frameCount, Device::MixBenchmark& result );
+    void benchmarkMixer( const std::filesystem::path& filePath, uint32_t voiceCount, uint64_t frameCount, Device::MixBenchmark& result );
+
+    ma_device    device {};
+    ma_engine    engine {};
+    // Mixes the voices of the voice pools on top of the engine.
+    Mixer        mixer;
+    CommandQueue commands { &engine, &mixer };
+    StreamWorker streamWorker;
+    VoiceLimit   voiceLimit { 32 };
+
+    // Headless mode mixes into this buffer, at most this many frames at a time.
+    static constexpr uint64_t mixChunkFrames = 1024;
+    std::vector<float>        mixBuffer;
+
+    ma_encoder wavEncoder {};
+    bool       wavOpen = false;
+
+    // False if the device or the engine failed to initialize, nothing may touch the engine then.
+    bool initialized = false;
 };
 }  // namespace Audio
 
@@ -64,16 +145,65 @@ DeviceImpl::DeviceImpl()
     ma_engine_config config = ma_engine_config_init();
     config.listenerCount    = MA_ENGINE_MAX_LISTENERS;
 
+    if ( headlessConfig.enabled )
+    {
+        // Without a device, `mix` drives the engine and applies the commands.
+        config.noDevice   = MA_TRUE;
+        config.channels   = headlessConfig.channels;
+        config.sampleRate = headlessConfig.sampleRate;
+        mixBuffer.resize( mixChunkFrames * headlessConfig.channels );
+    }
+    else
+    {
+        // The device is created here instead of by the engine, so the commands can be applied in its callback.
+        ma_device_config deviceConfig = ma_device_config_init( ma_device_type_playback );
+        deviceConfig.playback.format          = ma_format_f32;  // The format the engine mixes in.
+        deviceConfig.periodSizeInMilliseconds = periodConfig.sizeInMilliseconds;
+        deviceConfig.periods                  = periodConfig.count;
+        deviceConfig.performanceProfile       = ma_performance_profile_low_latency;
+        deviceConfig.dataCallback             = &DeviceImpl::dataCallback;
+        deviceConfig.pUserData                = this;
+
+        if ( ma_device_init( nullptr, &deviceConfig, &device ) != MA_SUCCESS )
+        {
+            std::cerr << "Failed to initialize audio device." << std::endl;
+            return;
+        }
+
+        config.pDevice = &device;
+    }
+
     if ( ma_engine_init( &config, &engine ) != MA_SUCCESS )
     {
         std::cerr << "Failed to initialize audio engine." << std::endl;
         return;
     }
+
+    initialized = true;
+    commands.setRunning( true );
 }
 
 DeviceImpl::~DeviceImpl()
 {
-    ma_engine_uninit( &engine );
+    setWavOutput( {} );
+
+    if ( initialized )
+    {
+        // Stops the device, so nothing drains the commands anymore.
+        ma_engine_uninit( &engine );
+        commands.setRunning( false );
+    }
+
+    // Does nothing if the device was never initialized.
+    ma_device_uninit( &device );
+}
+
+void DeviceImpl::dataCallback( ma_device* pDevice, void* pOutput, const void* /*pInput*/, ma_uint32 frameCount )
+{
+    auto* self = static_cast<DeviceImpl*>( pDevice->pUserData );
+    self->commands.execute();
+    ma_engine_read_pcm_frames( &self->engine, pOutput, frameCount, nullptr );
+    self->mixer.mix( static_cast<float*>( pOutput ), pDevice->playback.channels, frameCount );
 }
 
 Listener DeviceImpl::getListener( uint32_t listenerIndex )
@@ -88,27 +218,276 @@ Listener DeviceImpl::getListener( uint32_t listenerIndex )
 
 void DeviceImpl::setMasterVolume( float volume )
 {
-    ma_engine_set_volume( &engine, volume );
+    commands.push( { Command::Type::SetMasterVolume, nullptr, volume } );
 }
 
 Sound DeviceImpl::loadSound( const std::filesystem::path& filePath )
 {
-    auto sound = std::make_shared<SoundImpl>( filePath, &engine, nullptr, MA_SOUND_FLAG_DECODE );
+    auto sound = std::make_shared<SoundImpl>( filePath, &engine, &commands, nullptr, MA_SOUND_FLAG_DECODE );
     return MakeSound( std::move( sound ) );
 }
 
 Sound DeviceImpl::loadMusic( const std::filesystem::path& filePath )
 {
-    auto sound = std::make_shared<SoundImpl>( filePath, &engine, nullptr, MA_SOUND_FLAG_STREAM | MA_SOUND_FLAG_NO_SPATIALIZATION );
+    auto sound = std::make_shared<SoundImpl>( filePath, &engine, &commands, nullptr, MA_SOUND_FLAG_STREAM | MA_SOUND_FLAG_NO_SPATIALIZATION );
     return MakeSound( std::move( sound ) );
 }
 
+Music DeviceImpl::openMusic( const std::filesystem::path& filePath, bool looping )
+{
+    auto music = std::make_shared<MusicImpl>( filePath, looping, &engine, &commands, streamWorker );
+    return MakeMusic( std::move( music ) );
+}
+
+VoicePool DeviceImpl::loadVoicePool( const std::filesystem::path& filePath, uint32_t voiceCount, int priority )
+{
+    auto voicePool = std::make_shared<VoicePoolImpl>( filePath, voiceCount, priority, &engine, &commands, voiceLimit );
+    return MakeVoicePool( std::move( voicePool ) );
+}
+
+VoicePool DeviceImpl::createVoicePool( const SynthPreset& preset, uint32_t voiceCount, int priority )
+{
+    auto voicePool = std::make_shared<VoicePoolImpl>( preset, voiceCount, priority, &engine, &commands, voiceLimit );
+    return MakeVoicePool( std::move( voicePool ) );
+}
+
+void DeviceImpl::setMaxVoices( uint32_t maxVoices )
+{
+    voiceLimit.setMaxVoices( maxVoices );
+}
+
+uint32_t DeviceImpl::getMaxVoices() const
+{
+    return voiceLimit.getMaxVoices();
+}
+
 Waveform DeviceImpl::createWaveform( Waveform::Type type, float amplitude, float frequency )
 {
     auto waveform = std::make_shared<WaveformImpl>( type, amplitude, frequency, &engine );
     return MakeWaveform( std::move( waveform ) );
 }
 
+double DeviceImpl::getOutputLatency() const
+{
+    if ( headlessConfig.enabled || ma_device_get_state( &device ) == ma_device_state_uninitialized )
+        return 0.0;
+
+    const auto& playback = device.playback;
+    return static_cast<double>( playback.internalPeriodSizeInFrames ) * playback.internalPeriods / playback.internalSampleRate;
+}
+
+Device::LatencyMeasurement DeviceImpl::measureLatency( uint32_t eventCount )
+{
+    Device::LatencyMeasurement result;
+    if ( !ma_device_is_started( &device ) )
+        return result;
+
+    result.outputLatency = getOutputLatency();
+
+    // Events happen at any point between two callbacks, so wait a random part of a few periods before each one.
+    const double                           periodSeconds = result.outputLatency / std::max( device.playback.internalPeriods, 1u );
+    std::minstd_rand                       random;
+    std::uniform_real_distribution<double> delay( periodSeconds, periodSeconds * 9.0 );
+
+    double total = 0.0;
+    for ( uint32_t i = 0; i < eventCount; ++i )
+    {
+        std::this_thread::sleep_for( std::chrono::duration<double>( delay( random ) ) );
+
+        const auto     start    = std::chrono::steady_clock::now();
+        const uint64_t sequence = commands.push( { Command::Type::Mark } );
+        if ( sequence == 0 )
+            continue;
+
+        commands.wait( sequence );
+        const double latency = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count() + result.outputLatency;
+
+        total += latency;
+        result.maximumLatency = std::max( result.maximumLatency, latency );
+        ++result.eventCount;
+    }
+
+    if ( result.eventCount > 0 )
+        result.averageLatency = total / result.eventCount;
+
+    return result;
+}
+
+void DeviceImpl::mix( uint64_t frameCount )
+{
+    if ( !headlessConfig.enabled || !initialized )
+        return;
+
+    commands.execute();
+
+    while ( frameCount > 0 )
+    {
+        const uint64_t frames = std::min( frameCount, mixChunkFrames );
+        ma_engine_read_pcm_frames( &engine, mixBuffer.data(), frames, nullptr );
+        mixer.mix( mixBuffer.data(), headlessConfig.channels, frames );
+
+        if ( wavOpen )
+            ma_encoder_write_pcm_frames( &wavEncoder, mixBuffer.data(), frames, nullptr );
+
+        frameCount -= frames;
+    }
+}
+
+bool DeviceImpl::setWavOutput( const std::filesystem::path& filePath )
+{
+    if ( wavOpen )
+    {
+        ma_encoder_uninit( &wavEncoder );
+        wavOpen = false;
+    }
+
+    if ( !headlessConfig.enabled || !initialized || filePath.empty() )
+        return false;
+
+    const ma_encoder_config config = ma_encoder_config_init( ma_encoding_format_wav, ma_format_f32, ma_engine_get_channels( &engine ),
+                                                             ma_engine_get_sample_rate( &engine ) );
+
+    if ( ma_encoder_init_file_w( filePath.c_str(), &config, &wavEncoder ) != MA_SUCCESS )
+    {
+        std::cerr << "Failed to open WAV output: " << filePath.string() << std::endl;
+        return false;
+    }
+
+    wavOpen = true;
+    return true;
+}
+
+Device::MixBenchmark DeviceImpl::benchmarkMix( const std::filesystem::path& filePath, uint32_t voiceCount, double seconds,
+                                               Device::MixPath mixPath )
+{
+    Device::MixBenchmark result;
+    if ( !headlessConfig.enabled || !initialized || voiceCount == 0 )
+        return result;
+
+    const uint32_t sampleRate = ma_engine_get_sample_rate( &engine );
+    const uint64_t frameCount = static_cast<uint64_t>( seconds * sampleRate );
+
+    if ( mixPath == Device::MixPath::NodeGraph )
+        benchmarkNodeGraph( filePath, voiceCount, frameCount, result );
+    else
+        benchmarkMixer( filePath, voiceCount, frameCount, result );
+
+    if ( result.voiceCount > 0 )
+        result.mixedSeconds = static_cast<double>( frameCount ) / sampleRate;
+
+    return result;
+}
+
+void DeviceImpl::benchmarkNodeGraph( const std::filesystem::path& filePath, uint32_t voiceCount, uint64_t frameCount, Device::MixBenchmark& result )
+{
+    // Sized once, a ma_sound can't be moved after it is initialized.
+    std::vector<ma_sound> voices( voiceCount );
+    if ( ma_sound_init_from_file_w( &engine, filePath.c_str(), MA_SOUND_FLAG_DECODE, nullptr, nullptr, &voices[0] ) != MA_SUCCESS )
+    {
+        std::cerr << "Failed to initialize benchmark sound from source: " << filePath.string() << std::endl;
+        return;
+    }
+
+    uint32_t initialized = 1;
+    for ( ; initialized < voiceCount; ++initialized )
+    {
+        if ( ma_sound_init_copy( &engine, &voices[0], MA_SOUND_FLAG_DECODE, nullptr, &voices[initialized] ) != MA_SUCCESS )
+            break;
+
+        // See VoicePoolImpl, the copy doesn't release its data source otherwise.
+        voices[initialized].ownsDataSource = MA_TRUE;
+    }
+
+    // In headless mode this thread is the mixer, so the voices can be started directly.
+    for ( uint32_t i = 0; i < initialized; ++i )
+    {
+        ma_sound_set_looping( &voices[i], MA_TRUE );
+        ma_sound_start( &voices[i] );
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    mix( frameCount );
+    const auto end = std::chrono::steady_clock::now();
+
+    for ( uint32_t i = 0; i < initialized; ++i )
+        ma_sound_uninit( &voices[i] );
+
+    result.voiceCount = initialized;
+    result.mixTime    = std::chrono::duration<double>( end - start ).count();
+}
+
+void DeviceImpl::benchmarkMixer( const std::filesystem::path& filePath, uint32_t voiceCount, uint64_t frameCount, Device::MixBenchmark& result )
+{
+    std::vector<float> samples;
+    if ( !decodeStereo( filePath, ma_engine_get_sample_rate( &engine ), samples ) )
+    {
+        std::cerr << "Failed to initialize benchmark sound from source: " << filePath.string() << std::endl;
+        return;
+    }
+
+    // Sized once, the mixer holds on to the voices while they play.
+    std::vector<MixerVoice> voices( std::min( voiceCount, Mixer::MaxVoices ) );
+
+    // In headless mode this thread is the mixer, so the voices can be started directly.
+    for ( MixerVoice& voice: voices )
+    {
+        voice.samples    = samples.data();
+        voice.frameCount = samples.size() / 2;
+        voice.looping    = true;
+        mixer.start( &voice, 1.0f, 0.0f );
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    mix( frameCount );
+    const auto end = std::chrono::steady_clock::now();
+
+    for ( MixerVoice& voice: voices )
+        mixer.stop( &voice );
+
+    result.voiceCount = static_cast<uint32_t>( voices.size() );
+    result.mixTime    = std::chrono::duration<double>( end - start ).count();
+}
+
+void Device::setHeadless( uint32_t sampleRate, uint32_t channels )
+{
+    headlessConfig = { true, sampleRate, channels };
+}
+
+bool Device::isHeadless()
+{
+    return headlessConfig.enabled;
+}
+
+void Device::setPeriods( uint32_t periodSizeInMilliseconds, uint32_t periodCount )
+{
+    periodConfig = { periodSizeInMilliseconds, periodCount };
+}
+
+double Device::getOutputLatency()
+{
+    return DeviceImpl::get().getOutputLatency();
+}
+
+Device::LatencyMeasurement Device::measureLatency( uint32_t eventCount )
+{
+    return DeviceImpl::get().measureLatency( eventCount );
+}
+
+void Device::mix( uint64_t frameCount )
+{
+    DeviceImpl::get().mix( frameCount );
+}
+
+bool Device::setWavOutput( const std::filesystem::path& filePath )
+{
+    return DeviceImpl::get().setWavOutput( filePath );
+}
+
+Device::MixBenchmark Device::benchmarkMix( const std::filesystem::path& filePath, uint32_t voiceCount, double seconds, MixPath mixPath )
+{
+    return DeviceImpl::get().benchmarkMix( filePath, voiceCount, seconds, mixPath );
+}
+
 void Device::setMasterVolume( float volume )
 {
     DeviceImpl::get().setMasterVolume( volume );
@@ -129,6 +508,31 @@ Sound Device::loadMusic( const std::filesystem::path& filePath )
     return DeviceImpl::get().loadMusic( filePath );
 }
 
+Music Device::openMusic( const std::filesystem::path& filePath, bool looping )
+{
+    return DeviceImpl::get().openMusic( filePath, looping );
+}
+
+VoicePool Device::loadVoicePool( const std::filesystem::path& filePath, uint32_t voiceCount, int priority )
+{
+    return DeviceImpl::get().loadVoicePool( filePath, voiceCount, priority );
+}
+
+VoicePool Device::createVoicePool( const SynthPreset& preset, uint32_t voiceCount, int priority )
+{
+    return DeviceImpl::get().createVoicePool( preset, voiceCount, priority );
+}
+
+void Device::setMaxVoices( uint32_t maxVoices )
+{
+    DeviceImpl::get().setMaxVoices( maxVoices );
+}
+
+uint32_t Device::getMaxVoices()
+{
+    return DeviceImpl::get().getMaxVoices();
+}
+
 Waveform Device::createWaveform( Waveform::Type type, float amplitude, float frequency )
 {
     return DeviceImpl::get().createWaveform( type, amplitude, frequency );
@@ -0,0 +1,173 @@
+#include "Mixer.hpp"
+
+#include "Resampler.hpp"
+#include "miniaudio.h"
+
+#include <algorithm>
+
+#if defined( __SSE__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 1 )
+    #define AUDIO_MIXER_SSE 1
+    #include <xmmintrin.h>
+#endif
+
+using namespace Audio;
+
+namespace
+{
+// Adds frameCount stereo frames of pIn to pOut (both interleaved stereo).
+void mixStereo( float* pOut, const float* pIn, uint64_t frameCount, float gainLeft, float gainRight )
+{
+    uint64_t i = 0;
+
+#if AUDIO_MIXER_SSE
+    // 4 frames (2 vectors of left/right pairs) per iteration.
+    const __m128 gain = _mm_setr_ps( gainLeft, gainRight, gainLeft, gainRight );
+    for ( ; i + 4 <= frameCount; i += 4 )
+    {
+        float* out = pOut + i * 2;
+        const float* in = pIn + i * 2;
+        _mm_storeu_ps( out, _mm_add_ps( _mm_loadu_ps( out ), _mm_mul_ps( _mm_loadu_ps( in ), gain ) ) );
+        _mm_storeu_ps( out + 4, _mm_add_ps( _mm_loadu_ps( out + 4 ), _mm_mul_ps( _mm_loadu_ps( in + 4 ), gain ) ) );
+    }
+#endif
+
+    for ( ; i < frameCount; ++i )
+    {
+        pOut[i * 2] += pIn[i * 2] * gainLeft;
+        pOut[i * 2 + 1] += pIn[i * 2 + 1] * gainRight;
+    }
+}
+
+// The same for any other output layout: mono gets both sides, extra channels stay silent.
+void mixGeneric( float* pOut, uint32_t channels, const float* pIn, uint64_t frameCount, float gainLeft, float gainRight )
+{
+    for ( uint64_t i = 0; i < frameCount; ++i )
+    {
+        const float left  = pIn[i * 2] * gainLeft;
+        const float right = pIn[i * 2 + 1] * gainRight;
+
+        if ( channels == 1 )
+        {
+            pOut[i] += ( left + right ) * 0.5f;
+        }
+        else
+        {
+            pOut[i * channels] += left;
+            pOut[i * channels + 1] += right;
+        }
+    }
+}
+}  // namespace
+
+bool Audio::decodeStereo( const std::filesystem::path& filePath, uint32_t sampleRate, std::vector<float>& samples )
+{
+    // Decoded at the rate of the file, the resampler of the decoder is made for real time and not for quality.
+    const ma_decoder_config config = ma_decoder_config_init( ma_format_f32, 2, 0 );
+
+    ma_decoder decoder;
+    if ( ma_decoder_init_file_w( filePath.c_str(), &config, &decoder ) != MA_SUCCESS )
+        return false;
+
+    // The length isn't known up front for every format, so read until the decoder runs out.
+    constexpr ma_uint64 chunkFrames = 4096;
+    samples.clear();
+
+    ma_uint64 framesRead = 0;
+    do
+    {
+        const size_t offset = samples.size();
+        samples.resize( offset + chunkFrames * 2 );
+        ma_decoder_read_pcm_frames( &decoder, samples.data() + offset, chunkFrames, &framesRead );
+        samples.resize( offset + framesRead * 2 );
+    } while ( framesRead == chunkFrames );
+
+    const uint32_t fileRate = decoder.outputSampleRate;
+    ma_decoder_uninit( &decoder );
+
+    if ( fileRate != sampleRate )
+        samples = resampleStereo( samples, fileRate, sampleRate );
+
+    samples.shrink_to_fit();
+    return !samples.empty();
+}
+
+void Mixer::start( MixerVoice* voice, float volume, float pan )
+{
+    pan = std::clamp( pan, -1.0f, 1.0f );
+
+    // Balance, like the default pan mode of miniaudio: the far side gets quieter.
+    voice->cursor    = 0;
+    voice->gainLeft  = volume * ( pan > 0.0f ? 1.0f - pan : 1.0f );
+    voice->gainRight = volume * ( pan < 0.0f ? 1.0f + pan : 1.0f );
+
+    if ( !voice->mixing )
+    {
+        if ( voiceCount == MaxVoices )
+            return;
+
+        voices[voiceCount++] = voice;
+        voice->mixing        = true;
+    }
+
+    voice->playing.store( true, std::memory_order_release );
+}
+
+void Mixer::stop( MixerVoice* voice )
+{
+    for ( uint32_t i = 0; i < voiceCount; ++i )
+    {
+        if ( voices[i] == voice )
+        {
+            remove( i );
+            return;
+        }
+    }
+}
+
+void Mixer::setMasterVolume( float volume )
+{
+    masterVolume = volume;
+}
+
+void Mixer::mix( float* pOutput, uint32_t channels, uint64_t frameCount )
+{
+    for ( uint32_t i = 0; i < voiceCount; )
+    {
+        MixerVoice* voice     = voices[i];
+        const float gainLeft  = voice->gainLeft * masterVolume;
+        const float gainRight = voice->gainRight * masterVolume;
+
+        uint64_t done = 0;
+        while ( done < frameCount && voice->cursor < voice->frameCount )
+        {
+            const uint64_t frames = std::min( frameCount - done, voice->frameCount - voice->cursor );
+            const float*   in     = voice->samples + voice->cursor * 2;
+
+            if ( channels == 2 )
+                mixStereo( pOutput + done * 2, in, frames, gainLeft, gainRight );
+            else
+                mixGeneric( pOutput + done * channels, channels, in, frames, gainLeft, gainRight );
+
+            done += frames;
+            voice->cursor += frames;
+
+            if ( voice->cursor == voice->frameCount && voice->looping )
+                voice->cursor = 0;
+        }
+
+        // The last voice takes the place of a voice that ended, so it is mixed next.
+        if ( voice->cursor >= voice->frameCount )
+            remove( i );
+        else
+            ++i;
+    }
+}
+
+void Mixer::remove( uint32_t index )
+{
+    MixerVoice* voice = voices[index];
+    voice->mixing     = false;
+    voice->playing.store( false, std::memory_order_release );
+
+    voices[index] = voices[--voiceCount];
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace Audio
+{
+/// <summary>
+/// A voice of the mixer, plays decoded stereo samples that it doesn't own.
+/// </summary>
+struct MixerVoice
+{
+    // Interleaved stereo frames in the format the mixer mixes in, shared by every voice of a pool.
+    const float* samples    = nullptr;
+    uint64_t     frameCount = 0;
+    bool         looping    = false;
+
+    // Only used by the audio thread.
+    uint64_t cursor    = 0;
+    float    gainLeft  = 1.0f;
+    float    gainRight = 1.0f;
+    bool     mixing    = false;
+
+    // Set by the audio thread, so other threads can see when the voice ends.
+    std::atomic<bool> playing { false };
+};
+
+/// <summary>
+/// Decode a whole file to interleaved stereo float frames, the format the mixer mixes in.
+/// The file is converted to the sample rate of the mix here, so the mixer never resamples.
+/// </summary>
+/// <param name="filePath">The path to the sound file.</param>
+/// <param name="sampleRate">The sample rate of the mix (the device), the file is resampled if it differs.</param>
+/// <param name="samples">Receives the decoded frames.</param>
+/// <returns>`true` if the file was decoded.</returns>
+bool decodeStereo( const std::filesystem::path& filePath, uint32_t sampleRate, std::vector<float>& samples );
+
+/// <summary>
+/// Mixes voices straight into the output buffer, with only a gain per channel.
+/// This is much cheaper than a `ma_sound` per voice in the node graph of the engine.
+/// Every function is only called by the audio thread (through the command queue).
+/// </summary>
+class Mixer
+{
+public:
+    static constexpr uint32_t MaxVoices = 256;
+
+    /// <summary>
+    /// Start (or restart) a voice from its first frame.
+    /// </summary>
+    /// <param name="volume">The volume of the voice.</param>
+    /// <param name="pan">The balance of the voice, -1 is left and 1 is right.</param>
+    void start( MixerVoice* voice, float volume, float pan );
+    void stop( MixerVoice* voice );
+
+    void setMasterVolume( float volume );
+
+    /// <summary>
+    /// Add the playing voices to interleaved float frames.
+    /// </summary>
+    void mix( float* pOutput, uint32_t channels, uint64_t frameCount );
+
+private:
+    void remove( uint32_t index );
+
+    // The voices that are playing, in no particular order.
+    std::array<MixerVoice*, MaxVoices> voices {};
+    uint32_t                           voiceCount   = 0;
+    float                              masterVolume = 1.0f;
+};
+}  // namespace Audio
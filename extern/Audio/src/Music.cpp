@@ -0,0 +1,83 @@
+#include <Audio/Device.hpp>
+#include <Audio/Music.hpp>
+
+#include "MusicImpl.hpp"
+
+using namespace Audio;
+
+Music::Music()                              = default;
+Music::~Music()                             = default;
+Music::Music( const Music& )                = default;
+Music::Music( Music&& ) noexcept            = default;
+Music& Music::operator=( const Music& )     = default;
+Music& Music::operator=( Music&& ) noexcept = default;
+
+Music& Music::operator=( nullptr_t ) noexcept
+{
+    impl = nullptr;
+    return *this;
+}
+
+bool Music::operator==( nullptr_t ) const noexcept
+{
+    return impl == nullptr;
+}
+
+bool Music::operator!=( nullptr_t ) const noexcept
+{
+    return impl != nullptr;
+}
+
+Music::operator bool() const noexcept
+{
+    return impl != nullptr;
+}
+
+Music::Music( std::shared_ptr<MusicImpl> impl )
+: impl { std::move( impl ) }
+{}
+
+Music::Music( const std::filesystem::path& filePath, bool looping )
+{
+    open( filePath, looping );
+}
+
+void Music::open( const std::filesystem::path& filePath, bool looping )
+{
+    *this = Device::openMusic( filePath, looping );
+}
+
+void Music::play()
+{
+    impl->play();
+}
+
+void Music::stop()
+{
+    impl->stop();
+}
+
+void Music::fadeIn( uint64_t milliseconds )
+{
+    impl->fadeIn( milliseconds );
+}
+
+void Music::fadeOut( uint64_t milliseconds )
+{
+    impl->fadeOut( milliseconds );
+}
+
+bool Music::isPlaying() const
+{
+    return impl->isPlaying();
+}
+
+void Music::setVolume( float volume )
+{
+    impl->setVolume( volume );
+}
+
+float Music::getVolume() const
+{
+    return impl->getVolume();
+}
@@ -0,0 +1,280 @@
+#include "MusicImpl.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+using namespace Audio;
+
+StreamWorker::~StreamWorker()
+{
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+        running = false;
+    }
+    wake.notify_one();
+
+    if ( thread.joinable() )
+        thread.join();
+}
+
+void StreamWorker::add( MusicImpl* music )
+{
+    std::lock_guard<std::mutex> lock( mutex );
+    tracks.push_back( music );
+
+    if ( !running )
+    {
+        running = true;
+        thread  = std::thread( &StreamWorker::run, this );
+    }
+}
+
+void StreamWorker::remove( MusicImpl* music )
+{
+    // Waits for the worker if it is decoding, so the track isn't used afterwards.
+    std::lock_guard<std::mutex> lock( mutex );
+    tracks.erase( std::remove( tracks.begin(), tracks.end(), music ), tracks.end() );
+}
+
+void StreamWorker::run()
+{
+    std::unique_lock<std::mutex> lock( mutex );
+    while ( running )
+    {
+        for ( MusicImpl* music: tracks )
+            music->prefetch();
+
+        wake.wait_for( lock, interval, [this] { return !running; } );
+    }
+}
+
+MusicImpl::MusicImpl( const std::filesystem::path& filePath, bool looping, ma_engine* pEngine, CommandQueue* pCommands, StreamWorker& worker )
+: engine { pEngine }
+, commands { pCommands }
+, worker { worker }
+, looping { looping }
+{
+    // Decode straight into the format the engine mixes in, so the audio thread only copies.
+    channels                       = ma_engine_get_channels( engine );
+    sampleRate                     = ma_engine_get_sample_rate( engine );
+    const ma_decoder_config config = ma_decoder_config_init( ma_format_f32, channels, sampleRate );
+
+    if ( ma_decoder_init_file_w( filePath.c_str(), &config, &decoder ) != MA_SUCCESS )
+    {
+        std::cerr << "Failed to open music: " << filePath.string() << std::endl;
+        return;
+    }
+
+    if ( ma_pcm_rb_init( ma_format_f32, channels, prefetchFrames, nullptr, nullptr, &ring ) != MA_SUCCESS )
+    {
+        std::cerr << "Failed to allocate the stream for music: " << filePath.string() << std::endl;
+        ma_decoder_uninit( &decoder );
+        return;
+    }
+
+    static ma_data_source_vtable vtable = { &MusicImpl::onRead, nullptr, &MusicImpl::onGetDataFormat, nullptr, nullptr, nullptr, 0 };
+
+    ma_data_source_config sourceConfig = ma_data_source_config_init();
+    sourceConfig.vtable                = &vtable;
+    ma_data_source_init( &sourceConfig, &stream.base );
+    stream.music = this;
+
+    // Fill the ring before the track can be played.
+    prefetch();
+
+    if ( ma_sound_init_from_data_source( engine, &stream, MA_SOUND_FLAG_NO_SPATIALIZATION, nullptr, &sound ) != MA_SUCCESS )
+    {
+        std::cerr << "Failed to initialize music from source: " << filePath.string() << std::endl;
+        ma_data_source_uninit( &stream.base );
+        ma_pcm_rb_uninit( &ring );
+        ma_decoder_uninit( &decoder );
+        return;
+    }
+
+    initialized = true;
+    worker.add( this );
+}
+
+MusicImpl::~MusicImpl()
+{
+    if ( !initialized )
+        return;
+
+    worker.remove( this );
+    commands->wait( lastCommand );
+
+    ma_sound_uninit( &sound );
+    ma_data_source_uninit( &stream.base );
+    ma_pcm_rb_uninit( &ring );
+    ma_decoder_uninit( &decoder );
+}
+
+void MusicImpl::play()
+{
+    if ( !initialized )
+        return;
+
+    // Everything was read, start decoding from the start again.
+    if ( endOfStream.load( std::memory_order_acquire ) && ma_pcm_rb_available_read( &ring ) == 0 )
+        rewind.store( true, std::memory_order_release );
+
+    push( Command::Type::SetStopTime, 0.0f, UINT64_MAX );
+    push( Command::Type::Play );
+    lastPlayOrStop = lastCommand;
+    playQueued     = true;
+}
+
+void MusicImpl::stop()
+{
+    if ( !initialized )
+        return;
+
+    push( Command::Type::Stop );
+    lastPlayOrStop = lastCommand;
+    playQueued     = false;
+}
+
+void MusicImpl::fadeIn( uint64_t milliseconds )
+{
+    if ( !initialized )
+        return;
+
+    // A track that is still fading out fades back in from where it is.
+    const Command::Type fade = isPlaying() ? Command::Type::Fade : Command::Type::FadeFromSilence;
+    push( fade, 1.0f, toFrames( milliseconds ) );
+    play();
+}
+
+void MusicImpl::fadeOut( uint64_t milliseconds )
+{
+    if ( !initialized )
+        return;
+
+    push( Command::Type::Fade, 0.0f, toFrames( milliseconds ) );
+    push( Command::Type::SetStopTime, 0.0f, toFrames( milliseconds ) );
+    // The track still plays until the fade is done, but it won't be playing afterwards.
+    lastPlayOrStop = lastCommand;
+    playQueued     = false;
+}
+
+bool MusicImpl::isPlaying() const
+{
+    if ( !initialized )
+        return false;
+
+    if ( !commands->isDone( lastPlayOrStop ) )
+        return playQueued;
+
+    return ma_sound_is_playing( &sound ) == MA_TRUE;
+}
+
+void MusicImpl::setVolume( float _volume )
+{
+    volume = _volume;
+    push( Command::Type::SetVolume, volume );
+}
+
+float MusicImpl::getVolume() const
+{
+    return volume;
+}
+
+void MusicImpl::prefetch()
+{
+    if ( rewind.load( std::memory_order_acquire ) )
+    {
+        ma_decoder_seek_to_pcm_frame( &decoder, 0 );
+        endOfStream.store( false, std::memory_order_release );
+        rewind.store( false, std::memory_order_release );
+    }
+
+    while ( !endOfStream.load( std::memory_order_relaxed ) )
+    {
+        ma_uint32 frameCount = ma_pcm_rb_available_write( &ring );
+        if ( frameCount == 0 )
+            break;
+
+        void* pFrames = nullptr;
+        ma_pcm_rb_acquire_write( &ring, &frameCount, &pFrames );
+
+        ma_uint64 framesRead = 0;
+        ma_decoder_read_pcm_frames( &decoder, pFrames, frameCount, &framesRead );
+        ma_pcm_rb_commit_write( &ring, static_cast<ma_uint32>( framesRead ) );
+
+        if ( framesRead < frameCount )
+        {
+            if ( looping )
+                ma_decoder_seek_to_pcm_frame( &decoder, 0 );
+            else
+                endOfStream.store( true, std::memory_order_release );
+        }
+    }
+}
+
+ma_result MusicImpl::onRead( ma_data_source* pDataSource, void* pFramesOut, ma_uint64 frameCount, ma_uint64* pFramesRead )
+{
+    auto* stream = static_cast<Stream*>( pDataSource );
+    return stream->music->read( static_cast<float*>( pFramesOut ), frameCount, pFramesRead );
+}
+
+ma_result MusicImpl::onGetDataFormat( ma_data_source* pDataSource, ma_format* pFormat, ma_uint32* pChannels, ma_uint32* pSampleRate,
+                                      ma_channel* pChannelMap, size_t channelMapCap )
+{
+    const MusicImpl* music = static_cast<Stream*>( pDataSource )->music;
+
+    if ( pFormat )
+        *pFormat = ma_format_f32;
+    if ( pChannels )
+        *pChannels = music->channels;
+    if ( pSampleRate )
+        *pSampleRate = music->sampleRate;
+    if ( pChannelMap )
+        ma_channel_map_init_standard( ma_standard_channel_map_default, pChannelMap, channelMapCap, music->channels );
+
+    return MA_SUCCESS;
+}
+
+ma_result MusicImpl::read( float* pFramesOut, ma_uint64 frameCount, ma_uint64* pFramesRead )
+{
+    // Checked before reading, every frame of the track is in the ring once the end is set.
+    // A pending rewind is checked first, the worker clears the end before it clears the rewind.
+    const bool ended = !rewind.load( std::memory_order_acquire ) && endOfStream.load( std::memory_order_acquire );
+
+    ma_uint64 framesRead = 0;
+    while ( framesRead < frameCount )
+    {
+        ma_uint32 available = static_cast<ma_uint32>( std::min<ma_uint64>( frameCount - framesRead, prefetchFrames ) );
+        void*     pFrames   = nullptr;
+        ma_pcm_rb_acquire_read( &ring, &available, &pFrames );
+        if ( available == 0 )
+            break;
+
+        std::memcpy( pFramesOut + framesRead * channels, pFrames, available * channels * sizeof( float ) );
+        ma_pcm_rb_commit_read( &ring, available );
+        framesRead += available;
+    }
+
+    if ( framesRead < frameCount && !ended )
+    {
+        // The worker fell behind, play silence instead of waiting for it.
+        std::memset( pFramesOut + framesRead * channels, 0, ( frameCount - framesRead ) * channels * sizeof( float ) );
+        framesRead = frameCount;
+    }
+
+    if ( pFramesRead )
+        *pFramesRead = framesRead;
+
+    return framesRead == 0 ? MA_AT_END : MA_SUCCESS;
+}
+
+void MusicImpl::push( Command::Type type, float value, uint64_t frame )
+{
+    if ( const uint64_t sequence = commands->push( { type, &sound, value, frame } ) )
+        lastCommand = sequence;
+}
+
+uint64_t MusicImpl::toFrames( uint64_t milliseconds ) const
+{
+    return milliseconds * ma_engine_get_sample_rate( engine ) / 1000;
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "CommandQueue.hpp"
+#include "miniaudio.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Audio
+{
+class MusicImpl;
+
+/// <summary>
+/// The background thread that decodes every music track ahead of the audio thread.
+/// </summary>
+class StreamWorker
+{
+public:
+    StreamWorker() = default;
+    ~StreamWorker();
+
+    StreamWorker( const StreamWorker& )            = delete;
+    StreamWorker& operator=( const StreamWorker& ) = delete;
+
+    // Tracks register themselves for their lifetime, the thread starts with the first track.
+    void add( MusicImpl* music );
+    void remove( MusicImpl* music );
+
+private:
+    void run();
+
+    // How long the thread sleeps between filling the rings, well below the length of a ring.
+    static constexpr auto interval = std::chrono::milliseconds( 10 );
+
+    std::mutex              mutex;
+    std::condition_variable wake;
+    std::vector<MusicImpl*> tracks;
+    std::thread             thread;
+    bool                    running = false;
+};
+
+class MusicImpl
+{
+public:
+    MusicImpl( const std::filesystem::path& filePath, bool looping, ma_engine* pEngine, CommandQueue* pCommands, StreamWorker& worker );
+    ~MusicImpl();
+
+    MusicImpl( const MusicImpl& )            = delete;
+    MusicImpl& operator=( const MusicImpl& ) = delete;
+
+    void play();
+    void stop();
+
+    void fadeIn( uint64_t milliseconds );
+    void fadeOut( uint64_t milliseconds );
+
+    bool isPlaying() const;
+
+    void  setVolume( float volume );
+    float getVolume() const;
+
+    /// <summary>
+    /// Decode until the ring is full. Only called by the stream worker.
+    /// </summary>
+    void prefetch();
+
+private:
+    // The data source of the sound, reads the frames that were decoded ahead.
+    struct Stream
+    {
+        ma_data_source_base base;
+        MusicImpl*          music;
+    };
+
+    static ma_result onRead( ma_data_source* pDataSource, void* pFramesOut, ma_uint64 frameCount, ma_uint64* pFramesRead );
+    static ma_result onGetDataFormat( ma_data_source* pDataSource, ma_format* pFormat, ma_uint32* pChannels, ma_uint32* pSampleRate,
+                                     ma_channel* pChannelMap, size_t channelMapCap );
+
+    ma_result read( float* pFramesOut, ma_uint64 frameCount, ma_uint64* pFramesRead );
+    void      push( Command::Type type, float value = 0.0f, uint64_t frame = 0 );
+    uint64_t  toFrames( uint64_t milliseconds ) const;
+
+    // The number of frames that are decoded ahead, about a third of a second at 48 kHz.
+    static constexpr ma_uint32 prefetchFrames = 16384;
+
+    ma_engine*    engine   = nullptr;
+    CommandQueue* commands = nullptr;
+    StreamWorker& worker;
+
+    // The format the track is decoded to, the format the engine mixes in.
+    ma_uint32 channels   = 0;
+    ma_uint32 sampleRate = 0;
+
+    ma_decoder decoder {};
+    ma_pcm_rb  ring {};
+    Stream     stream {};
+    ma_sound   sound {};
+    bool       initialized = false;
+    bool       looping     = true;
+
+    // Set by the worker when a track that doesn't loop is decoded completely.
+    std::atomic<bool> endOfStream { false };
+    // Set by `play` after the end of the track, cleared by the worker once it decodes from the start again.
+    std::atomic<bool> rewind { false };
+
+    uint64_t lastCommand    = 0;
+    uint64_t lastPlayOrStop = 0;
+    bool     playQueued     = false;
+    float    volume         = 1.0f;
+};
+}  // namespace Audio
@@ -0,0 +1,123 @@
+#include "Resampler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+using namespace Audio;
+
+namespace
+{
+// Input frames on each side of an output frame, when upsampling (more when downsampling).
+constexpr int HalfTaps = 48;
+// The filter passes up to this part of the lowest Nyquist frequency, and stops just after it.
+constexpr double CutoffFactor = 0.92;
+// The shape of the Kaiser window, about 85 dB of stopband attenuation.
+constexpr double KaiserBeta = 8.6;
+// Up to this many filter phases are computed once, beyond that the filter is computed per frame.
+constexpr uint64_t MaxTablePhases = 4096;
+
+constexpr double Pi = 3.14159265358979323846;
+
+// The modified Bessel function of the first kind (order 0), for the Kaiser window.
+double besselI0( double x )
+{
+    double sum  = 1.0;
+    double term = 1.0;
+    for ( int k = 1; term > sum * 1e-12; ++k )
+    {
+        const double half = x / ( 2.0 * k );
+        term *= half * half;
+        sum += term;
+    }
+    return sum;
+}
+
+struct Filter
+{
+    int    halfTaps;
+    double cutoff;  // In cycles per input frame.
+    double windowScale;
+
+    // Fill the 2 * halfTaps weights of the input frames around an output frame that lies `fraction`
+    // of a frame after the first input frame at or before it.
+    void weights( double fraction, float* pWeights ) const
+    {
+        double sum = 0.0;
+        for ( int tap = 0; tap < 2 * halfTaps; ++tap )
+        {
+            const double distance = ( tap - halfTaps + 1 ) - fraction;
+            const double x        = 2.0 * cutoff * distance;
+            const double sinc     = x == 0.0 ? 1.0 : std::sin( Pi * x ) / ( Pi * x );
+            const double edge     = distance / halfTaps;
+            const double window   = edge * edge < 1.0 ? besselI0( KaiserBeta * std::sqrt( 1.0 - edge * edge ) ) * windowScale : 0.0;
+
+            pWeights[tap] = static_cast<float>( sinc * window );
+            sum += pWeights[tap];
+        }
+
+        // So a constant signal stays exactly the same.
+        for ( int tap = 0; tap < 2 * halfTaps; ++tap )
+            pWeights[tap] = static_cast<float>( pWeights[tap] / sum );
+    }
+};
+}  // namespace
+
+std::vector<float> Audio::resampleStereo( const std::vector<float>& samples, uint32_t inputRate, uint32_t outputRate )
+{
+    if ( inputRate == outputRate || inputRate == 0 || outputRate == 0 )
+        return samples;
+
+    // Output frame j lies at input frame j * step / phases, which is exact for any pair of rates.
+    const uint64_t divisor     = std::gcd( inputRate, outputRate );
+    const uint64_t phases      = outputRate / divisor;
+    const uint64_t step        = inputRate / divisor;
+    const int64_t  inputFrames = static_cast<int64_t>( samples.size() / 2 );
+    const uint64_t frameCount  = ( static_cast<uint64_t>( inputFrames ) * phases + step - 1 ) / step;
+
+    // When downsampling, the filter has to stop below the new Nyquist frequency, so it gets wider.
+    const double scale = std::min( 1.0, static_cast<double>( outputRate ) / inputRate );
+    const Filter filter { static_cast<int>( std::ceil( HalfTaps / scale ) ), 0.5 * CutoffFactor * scale, 1.0 / besselI0( KaiserBeta ) };
+    const int    taps = 2 * filter.halfTaps;
+
+    std::vector<float> table;
+    if ( phases <= MaxTablePhases )
+    {
+        table.resize( phases * taps );
+        for ( uint64_t phase = 0; phase < phases; ++phase )
+            filter.weights( static_cast<double>( phase ) / phases, &table[phase * taps] );
+    }
+    std::vector<float> frameWeights( taps );
+
+    std::vector<float> output( frameCount * 2 );
+    for ( uint64_t j = 0; j < frameCount; ++j )
+    {
+        const uint64_t position = j * step;
+        const int64_t  index    = static_cast<int64_t>( position / phases );
+        const uint64_t phase    = position % phases;
+
+        const float* weights = frameWeights.data();
+        if ( table.empty() )
+            filter.weights( static_cast<double>( phase ) / phases, frameWeights.data() );
+        else
+            weights = &table[phase * taps];
+
+        // Frames before the start and after the end are silent.
+        const int64_t first = index - filter.halfTaps + 1;
+        const int     begin = static_cast<int>( std::max<int64_t>( 0, -first ) );
+        const int     end   = static_cast<int>( std::min<int64_t>( taps, inputFrames - first ) );
+
+        float left  = 0.0f;
+        float right = 0.0f;
+        for ( int tap = begin; tap < end; ++tap )
+        {
+            left += samples[( first + tap ) * 2] * weights[tap];
+            right += samples[( first + tap ) * 2 + 1] * weights[tap];
+        }
+
+        output[j * 2]     = left;
+        output[j * 2 + 1] = right;
+    }
+
+    return output;
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Audio
+{
+/// <summary>
+/// Convert interleaved stereo float frames to another sample rate with a windowed sinc filter.
+/// This is far too slow to run in the mixer, but much cleaner than the linear resampler of miniaudio,
+/// so it is used once for sounds that are decoded when they are loaded.
+/// </summary>
+/// <param name="samples">The frames to convert.</param>
+/// <param name="inputRate">The sample rate of the frames.</param>
+/// <param name="outputRate">The sample rate to convert to.</param>
+/// <returns>The converted frames.</returns>
+std::vector<float> resampleStereo( const std::vector<float>& samples, uint32_t inputRate, uint32_t outputRate );
+}  // namespace Audio
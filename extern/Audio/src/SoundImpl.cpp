@@ -5,8 +5,9 @@
 
 using namespace Audio;
 
-SoundImpl::SoundImpl( const std::filesystem::path& filePath, ma_engine* pEngine, ma_sound_group* pGroup, uint32_t flags )
+SoundImpl::SoundImpl( const std::filesystem::path& filePath, ma_engine* pEngine, CommandQueue* pCommands, ma_sound_group* pGroup, uint32_t flags )
 : engine { pEngine }
+, commands { pCommands }
 , group { pGroup }
 {
 
@@ -18,17 +19,28 @@ SoundImpl::SoundImpl( const std::filesystem::path& filePath, ma_engine* pEngine,
 
 SoundImpl::~SoundImpl()
 {
+    commands->wait( lastCommand );
     ma_sound_uninit( &sound );
 }
 
+void SoundImpl::push( Command::Type type, float value, uint64_t frame )
+{
+    if ( const uint64_t sequence = commands->push( { type, &sound, value, frame } ) )
+        lastCommand = sequence;
+}
+
 void SoundImpl::play()
 {
-    ma_sound_start( &sound );
+    push( Command::Type::Play );
+    lastPlayOrStop = lastCommand;
+    playQueued     = true;
 }
 
 void SoundImpl::stop()
 {
-    ma_sound_stop( &sound );
+    push( Command::Type::Stop );
+    lastPlayOrStop = lastCommand;
+    playQueued     = false;
 }
 
 float SoundImpl::getDurationInSeconds() const
@@ -45,11 +57,14 @@ void SoundImpl::seek( uint64_t milliseconds )
     ma_uint32 sampleRate;
     ma_sound_get_data_format( &sound, nullptr, nullptr, &sampleRate, nullptr, 0 );
     const ma_uint64 pcmFrame = ( sampleRate * milliseconds ) / 1000;
-    ma_sound_seek_to_pcm_frame( &sound, pcmFrame );
+    push( Command::Type::Seek, 0.0f, pcmFrame );
 }
 
 bool SoundImpl::isPlaying() const
 {
+    if ( !commands->isDone( lastPlayOrStop ) )
+        return playQueued;
+
     return ma_sound_is_playing( &sound ) == MA_TRUE;
 }
 
@@ -77,24 +92,26 @@ void SoundImpl::setPinnedListener( const Listener& listener )
     }
 }
 
-void SoundImpl::setVolume( float volume )
+void SoundImpl::setVolume( float _volume )
 {
-    ma_sound_set_volume( &sound, volume );
+    volume = _volume;
+    push( Command::Type::SetVolume, volume );
 }
 
 float SoundImpl::getVolume() const
 {
-    return ma_sound_get_volume( &sound );
+    return volume;
 }
 
-void SoundImpl::setPan( float pan )
+void SoundImpl::setPan( float _pan )
 {
-    ma_sound_set_pan( &sound, pan );
+    pan = _pan;
+    push( Command::Type::SetPan, pan );
 }
 
 float SoundImpl::getPan() const
 {
-    return ma_sound_get_pan( &sound );
+    return pan;
 }
 
 void SoundImpl::setPitch( float pitch )
@@ -3,6 +3,7 @@
 #include <Audio/Listener.hpp>
 #include <Audio/Sound.hpp>
 
+#include "CommandQueue.hpp"
 #include "miniaudio.h"
 
 #include <chrono>
@@ -13,7 +14,7 @@ namespace Audio
 class SoundImpl
 {
 public:
-    SoundImpl( const std::filesystem::path& filePath, ma_engine* pEngine, ma_sound_group* pGroup = nullptr, uint32_t flags = 0 );
+    SoundImpl( const std::filesystem::path& filePath, ma_engine* pEngine, CommandQueue* pCommands, ma_sound_group* pGroup = nullptr, uint32_t flags = 0 );
     ~SoundImpl();
 
     void play();
@@ -79,9 +80,23 @@ public:
     void setStopTime( uint64_t milliseconds );
 
 private:
-    ma_engine*      engine = nullptr;
-    ma_sound_group* group  = nullptr;
+    // Play, stop, seek, volume and pan are queued for the audio thread.
+    void push( Command::Type type, float value = 0.0f, uint64_t frame = 0 );
+
+    ma_engine*      engine   = nullptr;
+    CommandQueue*   commands = nullptr;
+    ma_sound_group* group    = nullptr;
     ma_sound        sound {};
+
+    // The last queued command, the audio thread must be done with it before the sound is destroyed.
+    uint64_t lastCommand = 0;
+    // The last queued play or stop, until it is applied it decides if the sound is playing.
+    uint64_t lastPlayOrStop = 0;
+    bool     playQueued     = false;
+
+    // Queued changes are only visible in the sound once applied, so the last set values are kept.
+    float volume = 1.0f;
+    float pan    = 0.0f;
 };
 
 }  // namespace Audio
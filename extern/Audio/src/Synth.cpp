@@ -0,0 +1,203 @@
+#include "Synth.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+    #define AUDIO_SYNTH_SSE 1
+    #include <emmintrin.h>
+#endif
+
+using namespace Audio;
+
+namespace
+{
+// Gives every seed (and every lane) a different, non-zero noise state.
+uint32_t hashSeed( uint32_t x )
+{
+    x ^= x >> 16;
+    x *= 0x7feb352du;
+    x ^= x >> 15;
+    x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return x ? x : 1u;
+}
+
+// The envelope and mix of a preset, per second instead of in seconds.
+struct Shape
+{
+    float attackRate;
+    float decayRate;
+    float end;
+    float tone;
+    float noise;
+    float volume;
+
+    explicit Shape( const SynthPreset& preset )
+    : attackRate { preset.attack > 0.0f ? 1.0f / preset.attack : FLT_MAX }
+    , decayRate { preset.decay > 0.0f ? 1.0f / preset.decay : FLT_MAX }
+    , end { preset.attack + preset.hold + preset.decay }
+    , tone { 1.0f - std::clamp( preset.noise, 0.0f, 1.0f ) }
+    , noise { std::clamp( preset.noise, 0.0f, 1.0f ) }
+    , volume { preset.volume }
+    {}
+};
+
+#if AUDIO_SYNTH_SSE
+__m128 absolute( __m128 x )
+{
+    return _mm_andnot_ps( _mm_set1_ps( -0.0f ), x );
+}
+
+__m128 select( __m128 mask, __m128 a, __m128 b )
+{
+    return _mm_or_ps( _mm_and_ps( mask, a ), _mm_andnot_ps( mask, b ) );
+}
+
+// The tone at a phase (in cycles).
+__m128 oscillator( Waveform::Type type, __m128 phase )
+{
+    const __m128 one = _mm_set1_ps( 1.0f );
+    const __m128 x   = _mm_sub_ps( phase, _mm_cvtepi32_ps( _mm_cvttps_epi32( phase ) ) );
+
+    switch ( type )
+    {
+    case Waveform::Type::Square:
+        return select( _mm_cmplt_ps( x, _mm_set1_ps( 0.5f ) ), one, _mm_set1_ps( -1.0f ) );
+    case Waveform::Type::Triangle:
+        return _mm_sub_ps( one, _mm_mul_ps( _mm_set1_ps( 4.0f ), absolute( _mm_sub_ps( x, _mm_set1_ps( 0.5f ) ) ) ) );
+    case Waveform::Type::Sawtooth:
+        return _mm_sub_ps( _mm_add_ps( x, x ), one );
+    case Waveform::Type::Sine:
+    default:
+    {
+        // A parabola through the half cycles, corrected to within 0.1% of a sine.
+        const __m128 u = _mm_sub_ps( _mm_set1_ps( 1.0f ), _mm_add_ps( x, x ) );
+        __m128       y = _mm_mul_ps( _mm_mul_ps( _mm_set1_ps( 4.0f ), u ), _mm_sub_ps( one, absolute( u ) ) );
+        y              = _mm_add_ps( _mm_mul_ps( _mm_set1_ps( 0.225f ), _mm_sub_ps( _mm_mul_ps( y, absolute( y ) ), y ) ), y );
+        return y;
+    }
+    }
+}
+
+// Xorshift per lane, in [-1, 1).
+__m128 nextNoise( __m128i& state )
+{
+    state = _mm_xor_si128( state, _mm_slli_epi32( state, 13 ) );
+    state = _mm_xor_si128( state, _mm_srli_epi32( state, 17 ) );
+    state = _mm_xor_si128( state, _mm_slli_epi32( state, 5 ) );
+    return _mm_mul_ps( _mm_cvtepi32_ps( state ), _mm_set1_ps( 1.0f / 2147483648.0f ) );
+}
+
+// Rises over the attack, falls over the decay (squared, so the fade sounds even).
+__m128 envelope( const Shape& shape, __m128 time )
+{
+    const __m128 one  = _mm_set1_ps( 1.0f );
+    const __m128 rise = _mm_min_ps( _mm_mul_ps( time, _mm_set1_ps( shape.attackRate ) ), one );
+    const __m128 fall = _mm_max_ps( _mm_min_ps( _mm_mul_ps( _mm_sub_ps( _mm_set1_ps( shape.end ), time ), _mm_set1_ps( shape.decayRate ) ), one ),
+                                    _mm_setzero_ps() );
+    return _mm_mul_ps( rise, _mm_mul_ps( fall, fall ) );
+}
+#else
+float oscillator( Waveform::Type type, float phase )
+{
+    const float x = phase - std::floor( phase );
+
+    switch ( type )
+    {
+    case Waveform::Type::Square:
+        return x < 0.5f ? 1.0f : -1.0f;
+    case Waveform::Type::Triangle:
+        return 1.0f - 4.0f * std::abs( x - 0.5f );
+    case Waveform::Type::Sawtooth:
+        return 2.0f * x - 1.0f;
+    case Waveform::Type::Sine:
+    default:
+        return std::sin( 6.28318530718f * x );
+    }
+}
+
+float nextNoise( uint32_t& state )
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return static_cast<float>( static_cast<int32_t>( state ) ) / 2147483648.0f;
+}
+
+float envelope( const Shape& shape, float time )
+{
+    const float rise = std::min( time * shape.attackRate, 1.0f );
+    const float fall = std::clamp( ( shape.end - time ) * shape.decayRate, 0.0f, 1.0f );
+    return rise * fall * fall;
+}
+#endif
+}  // namespace
+
+uint64_t Audio::getSynthFrameCount( const SynthPreset& preset, uint32_t sampleRate )
+{
+    const double duration = std::max( preset.attack, 0.0f ) + std::max( preset.hold, 0.0f ) + std::max( preset.decay, 0.0f );
+    return std::max<uint64_t>( static_cast<uint64_t>( std::ceil( duration * sampleRate ) ), 1 );
+}
+
+void Audio::synthesize( const SynthPreset& preset, float pitch, uint32_t seed, uint32_t sampleRate, float* pOutput, uint64_t frameCount )
+{
+    const Shape  shape( preset );
+    const double startFrequency = std::max( preset.startFrequency * pitch, 1.0f );
+    const double endFrequency   = std::max( preset.endFrequency * pitch, 1.0f );
+    const float  frameTime      = 1.0f / sampleRate;
+
+    // The frequency is multiplied by this every frame, so it reaches the end frequency at the end of the decay.
+    const double sweep = std::pow( endFrequency / startFrequency, 1.0 / std::max( shape.end * static_cast<double>( sampleRate ), 1.0 ) );
+
+    // The phase (in cycles) adds up the frequency of every frame, so it is kept in doubles, one frame at a time.
+    double phase     = 0.0;
+    double frequency = startFrequency / sampleRate;
+
+#if AUDIO_SYNTH_SSE
+    __m128i noiseState = _mm_setr_epi32( static_cast<int>( hashSeed( seed * 4 ) ), static_cast<int>( hashSeed( seed * 4 + 1 ) ),
+                                         static_cast<int>( hashSeed( seed * 4 + 2 ) ), static_cast<int>( hashSeed( seed * 4 + 3 ) ) );
+    const __m128 laneTime = _mm_setr_ps( 0.0f, frameTime, 2.0f * frameTime, 3.0f * frameTime );
+    const __m128 tone     = _mm_set1_ps( shape.tone );
+    const __m128 noise    = _mm_set1_ps( shape.noise );
+    const __m128 volume   = _mm_set1_ps( shape.volume );
+
+    for ( uint64_t i = 0; i < frameCount; i += 4 )
+    {
+        alignas( 16 ) float phases[4];
+        for ( float& lanePhase: phases )
+        {
+            lanePhase = static_cast<float>( phase );
+            phase += frequency;
+            frequency *= sweep;
+        }
+        phase -= std::floor( phase );
+
+        const __m128 time   = _mm_add_ps( _mm_set1_ps( static_cast<float>( i ) * frameTime ), laneTime );
+        const __m128 mix    = _mm_add_ps( _mm_mul_ps( oscillator( preset.type, _mm_load_ps( phases ) ), tone ), _mm_mul_ps( nextNoise( noiseState ), noise ) );
+        const __m128 sample = _mm_mul_ps( mix, _mm_mul_ps( envelope( shape, time ), volume ) );
+
+        // Both channels get the same sample.
+        alignas( 16 ) float frames[8];
+        _mm_store_ps( frames, _mm_unpacklo_ps( sample, sample ) );
+        _mm_store_ps( frames + 4, _mm_unpackhi_ps( sample, sample ) );
+        std::copy_n( frames, std::min<uint64_t>( frameCount - i, 4 ) * 2, pOutput + i * 2 );
+    }
+#else
+    uint32_t noiseState = hashSeed( seed * 4 );
+
+    for ( uint64_t i = 0; i < frameCount; ++i )
+    {
+        const float mix    = oscillator( preset.type, static_cast<float>( phase ) ) * shape.tone + nextNoise( noiseState ) * shape.noise;
+        const float sample = mix * envelope( shape, i * frameTime ) * shape.volume;
+
+        pOutput[i * 2]     = sample;
+        pOutput[i * 2 + 1] = sample;
+
+        phase += frequency;
+        phase -= std::floor( phase );
+        frequency *= sweep;
+    }
+#endif
+}
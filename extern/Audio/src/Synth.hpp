@@ -0,0 +1,25 @@
+#pragma once
+
+#include <Audio/Synth.hpp>
+
+#include <cstdint>
+
+namespace Audio
+{
+/// <summary>
+/// Get the number of frames of a generated sound, from the start of the attack to the end of the decay.
+/// </summary>
+uint64_t getSynthFrameCount( const SynthPreset& preset, uint32_t sampleRate );
+
+/// <summary>
+/// Generate a sound into interleaved stereo float frames (the format the mixer mixes in).
+/// Four frames are generated at a time with SSE where it is available.
+/// </summary>
+/// <param name="preset">The sound to generate.</param>
+/// <param name="pitch">Multiplies the frequencies of the preset.</param>
+/// <param name="seed">The seed of the noise.</param>
+/// <param name="sampleRate">The sample rate of the mix.</param>
+/// <param name="pOutput">Receives `frameCount` frames.</param>
+/// <param name="frameCount">The number of frames to generate, see `getSynthFrameCount`.</param>
+void synthesize( const SynthPreset& preset, float pitch, uint32_t seed, uint32_t sampleRate, float* pOutput, uint64_t frameCount );
+}  // namespace Audio
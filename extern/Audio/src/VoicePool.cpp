@@ -0,0 +1,93 @@
+#include <Audio/Device.hpp>
+#include <Audio/VoicePool.hpp>
+
+#include "VoicePoolImpl.hpp"
+
+using namespace Audio;
+
+VoicePool::VoicePool()                                  = default;
+VoicePool::~VoicePool()                                 = default;
+VoicePool::VoicePool( const VoicePool& )                = default;
+VoicePool::VoicePool( VoicePool&& ) noexcept            = default;
+VoicePool& VoicePool::operator=( const VoicePool& )     = default;
+VoicePool& VoicePool::operator=( VoicePool&& ) noexcept = default;
+
+VoicePool& VoicePool::operator=( nullptr_t ) noexcept
+{
+    impl = nullptr;
+    return *this;
+}
+
+bool VoicePool::operator==( nullptr_t ) const noexcept
+{
+    return impl == nullptr;
+}
+
+bool VoicePool::operator!=( nullptr_t ) const noexcept
+{
+    return impl != nullptr;
+}
+
+VoicePool::operator bool() const noexcept
+{
+    return impl != nullptr;
+}
+
+VoicePool::VoicePool( std::shared_ptr<VoicePoolImpl> impl )
+: impl { std::move( impl ) }
+{}
+
+VoicePool::VoicePool( const std::filesystem::path& filePath, uint32_t voiceCount, int priority )
+{
+    load( filePath, voiceCount, priority );
+}
+
+void VoicePool::load( const std::filesystem::path& filePath, uint32_t voiceCount, int priority )
+{
+    *this = Device::loadVoicePool( filePath, voiceCount, priority );
+}
+
+VoicePool::VoicePool( const SynthPreset& preset, uint32_t voiceCount, int priority )
+{
+    load( preset, voiceCount, priority );
+}
+
+void VoicePool::load( const SynthPreset& preset, uint32_t voiceCount, int priority )
+{
+    *this = Device::createVoicePool( preset, voiceCount, priority );
+}
+
+bool VoicePool::play( float volume, float pan )
+{
+    return impl->play( volume, pan );
+}
+
+void VoicePool::stop()
+{
+    impl->stop();
+}
+
+void VoicePool::setVolume( float volume )
+{
+    impl->setVolume( volume );
+}
+
+float VoicePool::getVolume() const
+{
+    return impl->getVolume();
+}
+
+uint32_t VoicePool::getVoiceCount() const
+{
+    return impl->getVoiceCount();
+}
+
+uint32_t VoicePool::getPlayingCount() const
+{
+    return impl->getPlayingCount();
+}
+
+int VoicePool::getPriority() const
+{
+    return impl->getPriority();
+}
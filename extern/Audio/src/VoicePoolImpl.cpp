@@ -0,0 +1,253 @@
+#include "VoicePoolImpl.hpp"
+
+#include "Synth.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+
+using namespace Audio;
+
+VoiceLimit::VoiceLimit( uint32_t maxVoices )
+: maxVoices { maxVoices }
+{}
+
+void VoiceLimit::setMaxVoices( uint32_t _maxVoices )
+{
+    std::lock_guard<std::mutex> lock( mutex );
+    maxVoices = _maxVoices;
+}
+
+uint32_t VoiceLimit::getMaxVoices() const
+{
+    std::lock_guard<std::mutex> lock( mutex );
+    return maxVoices;
+}
+
+void VoiceLimit::add( VoicePoolImpl* pool )
+{
+    std::lock_guard<std::mutex> lock( mutex );
+    pools.push_back( pool );
+}
+
+void VoiceLimit::remove( VoicePoolImpl* pool )
+{
+    std::lock_guard<std::mutex> lock( mutex );
+    pools.erase( std::remove( pools.begin(), pools.end(), pool ), pools.end() );
+}
+
+bool VoiceLimit::play( VoicePoolImpl& pool, float volume, float pan )
+{
+    std::lock_guard<std::mutex> lock( mutex );
+
+    if ( pool.samples.empty() )
+        return false;
+
+    const uint32_t index = pool.getFreeOrOldestVoice();
+
+    // Restarting a voice that is still playing doesn't add a voice.
+    if ( !pool.isPlaying( pool.voices[index] ) )
+    {
+        uint32_t playing = 0;
+        for ( const VoicePoolImpl* p: pools )
+            playing += p->getPlayingCount();
+
+        if ( playing >= maxVoices )
+        {
+            // Steal from the pool with the lowest priority, the voice that started first if the priorities are equal.
+            VoicePoolImpl* victimPool  = nullptr;
+            uint32_t       victimIndex = 0;
+            for ( VoicePoolImpl* p: pools )
+            {
+                if ( p->priority > pool.priority )
+                    continue;
+
+                const uint32_t oldest = p->getOldestPlayingVoice();
+                if ( oldest == p->getVoiceCount() )
+                    continue;
+
+                if ( !victimPool || p->priority < victimPool->priority ||
+                     ( p->priority == victimPool->priority && p->voices[oldest].startedAt < victimPool->voices[victimIndex].startedAt ) )
+                {
+                    victimPool  = p;
+                    victimIndex = oldest;
+                }
+            }
+
+            if ( !victimPool )
+                return false;
+
+            victimPool->stopVoice( victimPool->voices[victimIndex] );
+        }
+    }
+
+    pool.startVoice( index, volume, pan, ++playCount );
+    return true;
+}
+
+VoicePoolImpl::VoicePoolImpl( const std::filesystem::path& filePath, uint32_t voiceCount, int priority, ma_engine* pEngine, CommandQueue* pCommands,
+                              VoiceLimit& limit )
+: commands { pCommands }
+, limit { limit }
+, voices( std::max( voiceCount, 1u ) )
+, priority { priority }
+{
+    // The voices are mixed by the mixer instead of the engine, so the file is decoded (and resampled) up front
+    // to the format the mixer mixes in.
+    if ( !decodeStereo( filePath, ma_engine_get_sample_rate( pEngine ), samples ) )
+        std::cerr << "Failed to initialize voice pool from source: " << filePath.string() << std::endl;
+
+    assignSamples( 1 );
+    limit.add( this );
+}
+
+VoicePoolImpl::VoicePoolImpl( const SynthPreset& preset, uint32_t voiceCount, int priority, ma_engine* pEngine, CommandQueue* pCommands,
+                              VoiceLimit& limit )
+: commands { pCommands }
+, limit { limit }
+, voices( std::max( voiceCount, 1u ) )
+, priority { priority }
+{
+    const uint32_t sampleRate     = ma_engine_get_sample_rate( pEngine );
+    const uint32_t variationCount = std::max( preset.variations, 1u );
+    const uint64_t frameCount     = getSynthFrameCount( preset, sampleRate );
+    samples.resize( variationCount * frameCount * 2 );
+
+    // The first version has the pitch of the preset, the others a random pitch around it.
+    std::minstd_rand                      random( preset.seed );
+    std::uniform_real_distribution<float> pitch( 1.0f - preset.pitchVariation, 1.0f + preset.pitchVariation );
+    for ( uint32_t i = 0; i < variationCount; ++i )
+        synthesize( preset, i == 0 ? 1.0f : pitch( random ), preset.seed + i, sampleRate, &samples[i * frameCount * 2], frameCount );
+
+    assignSamples( variationCount );
+    limit.add( this );
+}
+
+VoicePoolImpl::~VoicePoolImpl()
+{
+    limit.remove( this );
+
+    // The mixer must let go of the voices before they are destroyed. A dropped stop would leave the mixer
+    // reading a destroyed voice, so every voice is stopped (the mixer ignores the ones it doesn't hold)
+    // and the stops wait for room in the ring instead of being dropped.
+    for ( Voice& voice: voices )
+    {
+        if ( const uint64_t sequence = commands->pushBlocking( { Command::Type::StopVoice, nullptr, 0.0f, 0, &voice.mixerVoice } ) )
+            lastCommand = sequence;
+    }
+    commands->wait( lastCommand );
+}
+
+bool VoicePoolImpl::play( float _volume, float pan )
+{
+    return limit.play( *this, _volume, pan );
+}
+
+void VoicePoolImpl::stop()
+{
+    for ( Voice& voice: voices )
+    {
+        if ( isPlaying( voice ) )
+            stopVoice( voice );
+    }
+}
+
+void VoicePoolImpl::setVolume( float _volume )
+{
+    volume = _volume;
+}
+
+float VoicePoolImpl::getVolume() const
+{
+    return volume;
+}
+
+uint32_t VoicePoolImpl::getVoiceCount() const
+{
+    return static_cast<uint32_t>( voices.size() );
+}
+
+uint32_t VoicePoolImpl::getPlayingCount() const
+{
+    uint32_t playing = 0;
+    for ( const Voice& voice: voices )
+    {
+        if ( isPlaying( voice ) )
+            ++playing;
+    }
+    return playing;
+}
+
+int VoicePoolImpl::getPriority() const
+{
+    return priority;
+}
+
+void VoicePoolImpl::assignSamples( uint32_t variationCount )
+{
+    const uint64_t frameCount = samples.size() / 2 / variationCount;
+    for ( size_t i = 0; i < voices.size(); ++i )
+    {
+        voices[i].mixerVoice.samples    = samples.data() + ( i % variationCount ) * frameCount * 2;
+        voices[i].mixerVoice.frameCount = frameCount;
+    }
+}
+
+uint32_t VoicePoolImpl::getFreeOrOldestVoice() const
+{
+    uint32_t oldest     = 0;
+    uint32_t oldestFree = getVoiceCount();
+    for ( uint32_t i = 0; i < getVoiceCount(); ++i )
+    {
+        if ( !isPlaying( voices[i] ) && ( oldestFree == getVoiceCount() || voices[i].startedAt < voices[oldestFree].startedAt ) )
+            oldestFree = i;
+
+        if ( voices[i].startedAt < voices[oldest].startedAt )
+            oldest = i;
+    }
+    return oldestFree < getVoiceCount() ? oldestFree : oldest;
+}
+
+uint32_t VoicePoolImpl::getOldestPlayingVoice() const
+{
+    uint32_t oldest = getVoiceCount();
+    for ( uint32_t i = 0; i < getVoiceCount(); ++i )
+    {
+        if ( !isPlaying( voices[i] ) )
+            continue;
+
+        if ( oldest == getVoiceCount() || voices[i].startedAt < voices[oldest].startedAt )
+            oldest = i;
+    }
+    return oldest;
+}
+
+void VoicePoolImpl::startVoice( uint32_t index, float _volume, float pan, uint64_t playCount )
+{
+    Voice& voice = voices[index];
+    push( Command::Type::StartVoice, voice, volume * _volume, pan );
+    voice.startedAt      = playCount;
+    voice.lastPlayOrStop = lastCommand;
+    voice.playQueued     = true;
+}
+
+void VoicePoolImpl::stopVoice( Voice& voice )
+{
+    push( Command::Type::StopVoice, voice );
+    voice.lastPlayOrStop = lastCommand;
+    voice.playQueued     = false;
+}
+
+bool VoicePoolImpl::isPlaying( const Voice& voice ) const
+{
+    if ( !commands->isDone( voice.lastPlayOrStop ) )
+        return voice.playQueued;
+
+    return voice.mixerVoice.playing.load( std::memory_order_acquire );
+}
+
+void VoicePoolImpl::push( Command::Type type, Voice& voice, float value, float pan )
+{
+    if ( const uint64_t sequence = commands->push( { type, nullptr, value, 0, &voice.mixerVoice, pan } ) )
+        lastCommand = sequence;
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <Audio/Synth.hpp>
+
+#include "CommandQueue.hpp"
+#include "Mixer.hpp"
+#include "miniaudio.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <vector>
+
+namespace Audio
+{
+class VoicePoolImpl;
+
+/// <summary>
+/// Keeps the number of voices that play at once, over every voice pool, below a limit.
+/// </summary>
+class VoiceLimit
+{
+public:
+    explicit VoiceLimit( uint32_t maxVoices );
+
+    void     setMaxVoices( uint32_t maxVoices );
+    uint32_t getMaxVoices() const;
+
+    // Pools register themselves for their lifetime.
+    void add( VoicePoolImpl* pool );
+    void remove( VoicePoolImpl* pool );
+
+    /// <summary>
+    /// Start a voice of the pool, stopping the oldest voice of a pool with the lowest priority
+    /// (not higher than the priority of the pool) if the limit is reached.
+    /// </summary>
+    bool play( VoicePoolImpl& pool, float volume, float pan );
+
+private:
+    mutable std::mutex          mutex;
+    std::vector<VoicePoolImpl*> pools;
+    uint32_t                    maxVoices;
+    // Increased every time a voice starts, to find the voice that started first.
+    uint64_t                    playCount = 0;
+};
+
+class VoicePoolImpl
+{
+public:
+    VoicePoolImpl( const std::filesystem::path& filePath, uint32_t voiceCount, int priority, ma_engine* pEngine, CommandQueue* pCommands,
+                   VoiceLimit& limit );
+    VoicePoolImpl( const SynthPreset& preset, uint32_t voiceCount, int priority, ma_engine* pEngine, CommandQueue* pCommands,
+                   VoiceLimit& limit );
+    ~VoicePoolImpl();
+
+    VoicePoolImpl( const VoicePoolImpl& )            = delete;
+    VoicePoolImpl& operator=( const VoicePoolImpl& ) = delete;
+
+    bool play( float volume, float pan );
+    void stop();
+
+    void  setVolume( float volume );
+    float getVolume() const;
+
+    uint32_t getVoiceCount() const;
+    uint32_t getPlayingCount() const;
+    int      getPriority() const;
+
+private:
+    friend class VoiceLimit;
+
+    struct Voice
+    {
+        MixerVoice mixerVoice;
+        // The play count of the voice limit when this voice was started.
+        uint64_t startedAt = 0;
+        // The last queued play or stop, until it is applied it decides if the voice is playing.
+        uint64_t lastPlayOrStop = 0;
+        bool     playQueued     = false;
+    };
+
+    bool isPlaying( const Voice& voice ) const;
+    void stopVoice( Voice& voice );
+    // Queues the command for the audio thread.
+    void push( Command::Type type, Voice& voice, float value = 0.0f, float pan = 0.0f );
+
+    // Points the voices at the samples, which hold `variationCount` versions of the sound of equal length.
+    void assignSamples( uint32_t variationCount );
+
+    // Returns the index of the voice that isn't playing and started first (so the voices take turns),
+    // or the voice that started first if every voice is playing.
+    uint32_t getFreeOrOldestVoice() const;
+    // Returns the index of the playing voice that started first, or `getVoiceCount()` if no voice is playing.
+    uint32_t getOldestPlayingVoice() const;
+    void     startVoice( uint32_t index, float volume, float pan, uint64_t playCount );
+
+    CommandQueue* commands = nullptr;
+    VoiceLimit&   limit;
+    // The decoded sound as interleaved stereo frames at the sample rate of the engine, shared by every voice.
+    // A generated sound can have several versions one after the other, each voice plays one of them.
+    std::vector<float> samples;
+    // Sized once, the mixer holds on to the voices while they play.
+    std::vector<Voice> voices;
+    int                priority;
+    float              volume = 1.0f;
+    // The last queued command, the audio thread must be done with it before the voices are destroyed.
+    uint64_t lastCommand = 0;
+};
+}  // namespace Audio
@@ -2,9 +2,9 @@
 
 namespace Tmpl8 {
 
-	Fireball::Fireball( std::shared_ptr<Sprite> _sprite, vec2 _centerPos,
+	Fireball::Fireball( SpriteId _sprite, vec2 _centerPos,
 		vec2 _dir, float _hitBoxRadius, float _speed )
-		: Entity( std::move( _sprite ), _centerPos, _hitBoxRadius, _speed )
+		: Entity( _sprite, _centerPos, _hitBoxRadius, _speed )
 	{
 		speed *= speedMultiplier;
 		dir = _dir;
@@ -26,14 +26,7 @@ namespace Tmpl8 {
 		{
 			previousPos[i] = previousPos[i - 1];
 		}
-		previousPos[0] = centerPos;
-
-		centerPos.x += dir.x * speed * deltaTime;
-		centerPos.y += dir.y * speed * deltaTime;
-
-		/* Makes sure the fireball is in bounds */
-		justHitWall = false;
-		CheckWallCollision();
+		previousPos[0] = GetPos();
 	}
 
 	void Fireball::Draw(Surface* screen)
@@ -51,49 +44,19 @@ namespace Tmpl8 {
 		for (int i = size - offset; i >= 0; i -= decrement)
 		{
 			if (previousPos[i].x == 0.0f) { continue; }
-			sprite->DrawInColorAndBlend( screen,
+			GetSprite()->DrawInColorAndBlend( screen,
 				static_cast<int>(previousPos[i].x - halfWidth),
 				static_cast<int>(previousPos[i].y - halfHeight),
-				0xfd5f44,
+				frame, 0xfd5f44,
 				1.0f / static_cast<float>(i + 2),
 				shadowOffset, shadowOffset, shadowFadeLength, 0x000000, 0.8f / static_cast<float>(i + 2) );
 		}
 
-		sprite->DrawWithShadow( screen,
-			static_cast<int>(centerPos.x - halfWidth),
-			static_cast<int>(centerPos.y - halfHeight),
-			shadowOffset, shadowOffset, shadowFadeLength,
+		const vec2 pos = GetPos();
+		GetSprite()->DrawWithShadow( screen,
+			static_cast<int>(pos.x - halfWidth),
+			static_cast<int>(pos.y - halfHeight),
+			frame, shadowOffset, shadowOffset, shadowFadeLength,
 			0x000000, 0.5f );
 	}
-
-	void Fireball::CheckWallCollision()
-	{
-		/* Side wall collision check and correction */
-		if (centerPos.x - hitBoxRadius < backgroundOffset)
-		{
-			centerPos.x = backgroundOffset + hitBoxRadius;
-			dir.x = -dir.x;
-			justHitWall = true;
-		}
-		else if ((centerPos.x + hitBoxRadius - 1) >= (ScreenWidth - backgroundOffset))
-		{
-			centerPos.x = ScreenWidth - backgroundOffset - hitBoxRadius;
-			dir.x = -dir.x;
-			justHitWall = true;
-		}
-
-		/* Bottom and top wall collision check and correction */
-		if (centerPos.y - hitBoxRadius < backgroundOffset)
-		{
-			centerPos.y = backgroundOffset + hitBoxRadius;
-			dir.y = -dir.y;
-			justHitWall = true;
-		}
-		else if ((centerPos.y + hitBoxRadius - 1) >= (ScreenHeight - backgroundOffset))
-		{
-			centerPos.y = ScreenHeight - backgroundOffset - hitBoxRadius;
-			dir.y = -dir.y;
-			justHitWall = true;
-		}
-	}
 }
\ No newline at end of file
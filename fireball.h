@@ -12,17 +12,18 @@ namespace Tmpl8 {
 	{
 	public:
 		/* Constructor */
-		Fireball( std::shared_ptr<Sprite> sprite, vec2 centerPos,
+		Fireball( SpriteId sprite, vec2 centerPos,
 			vec2 dir, float hitBoxRadius, float speed );
 
+		/* Only updates the trail, moving and bouncing off the walls is done for all fireballs */
+		/* at once by Game::UpdateFireballs(), in the MotionBatch the fireball is bound to */
 		void Update( float deltaTime ) override;
 		void Draw(Surface* screen) override;
-		/* Checks collision with the edges of the game window */
-		void CheckWallCollision();
 
 		void SetErase() { toBeErased = true; }
 		[[nodiscard]] bool IsToBeErased() const { return toBeErased; }
-		[[nodiscard]] bool IsHittingWall() const { return justHitWall; }
+		/* Set by the last IntegrateAndReflect() over the fireball's batch */
+		[[nodiscard]] bool IsHittingWall() const { return motion && motion->hitWall[motionRow] != 0; }
 
 	private:
 
@@ -35,6 +36,5 @@ namespace Tmpl8 {
 
 		/* Used to erase and delete Fireballs in collisionManager.cpp */
 		bool toBeErased{ false };
-		bool justHitWall{ false };
 	};
 }
\ No newline at end of file
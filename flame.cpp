@@ -5,9 +5,9 @@
 
 namespace Tmpl8 {
 
-	Flame::Flame( std::shared_ptr<Sprite> _sprite, vec2 _centerPos,
+	Flame::Flame( SpriteId _sprite, vec2 _centerPos,
 					float _hitBoxRadius, float _speed )
-		: Entity( std::move( _sprite ), _centerPos, _hitBoxRadius, _speed )
+		: Entity( _sprite, _centerPos, _hitBoxRadius, _speed )
 	{
 		speed *= speedMultiplier;
 
@@ -53,12 +53,10 @@ namespace Tmpl8 {
 
 	void Flame::Draw( Surface* screen )
 	{
-		/* Changes the sprite's selected frame, one per tick for each Flame object */
-		sprite->SetFrame( frame );
-		sprite->DrawWithShadow( screen,
+		GetSprite()->DrawWithShadow( screen,
 			static_cast<int>(centerPos.x - halfWidth),
 			static_cast<int>(centerPos.y - halfHeight),
-			shadowOffset, shadowOffset, shadowFadeLength,
+			frame, shadowOffset, shadowOffset, shadowFadeLength,
 			0x000000, 0.5f );
 	}
 
@@ -9,7 +9,7 @@ namespace Tmpl8 {
 	{
 	public:
 		/* Constructor */
-		Flame( std::shared_ptr<Sprite> sprite, vec2 centerPos,
+		Flame( SpriteId sprite, vec2 centerPos,
 				float hitBoxRadius, float speed );
 
 		Flame( Flame&& ) = default;
@@ -24,7 +24,6 @@ namespace Tmpl8 {
 
 		void SetActive( bool state ) { active = state; }
 		[[nodiscard]] bool IsActive() const { return active; }
-		[[nodiscard]] vec2 GetDir() const { return dir; }
 		[[nodiscard]] vec2 GetHitBoxPos() const { return centerPos + (dir * 7); }
 		[[nodiscard]] Circle GetCircle() const override { return { hitBoxPos, hitBoxRadius }; }
 
@@ -33,7 +32,6 @@ namespace Tmpl8 {
 		bool active{ true };
 		vec2 hitBoxPos;
 
-		unsigned int frame;
 		/* Should the frame be updated */
 		bool updateFrame{ true };
 		
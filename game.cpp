@@ -3,42 +3,111 @@
 #include "surface.h"
 #include "mathFunctions.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <iostream>
 #include <SDL_events.h>
 #include <chrono>
 
-using std::unique_ptr;
-using std::make_shared;
-using std::make_unique;
-
 namespace Tmpl8
 {
 	/* Sprites */
-	shared_ptr<Sprite> player_sprite = make_shared<Sprite>( new Surface( "assets/player.png" ), 60 );
-	shared_ptr<Sprite> mushroom_sprite = make_shared<Sprite>( new Surface( "assets/mushroomMan.png" ), 60 );
-	shared_ptr<Sprite> flame_sprite = make_shared<Sprite>( new Surface( "assets/flame.png" ), 60 );
-	shared_ptr<Sprite> coalBasic_sprite = make_shared<Sprite>( new Surface( "assets/basicCoal.png" ), 8 );
-	shared_ptr<Sprite> coalBomb_sprite = make_shared<Sprite>( new Surface( "assets/bombCoal.png" ), 6 );
-	shared_ptr<Sprite> coalGold_sprite = make_shared<Sprite>( new Surface( "assets/goldCoal.png" ), 4 );
-	shared_ptr<Sprite> explosion_sprite = make_shared<Sprite>( new Surface( "assets/explosion.png" ), 8 );
-	shared_ptr<Sprite> fireball_sprite = make_shared<Sprite>( new Surface( "assets/fireball.png" ), 1 );
-	shared_ptr<Sprite> volume_sprite = make_shared<Sprite>( new Surface( "assets/volume.png" ), 4 );
-	unique_ptr<Sprite> background_sprite = make_unique<Sprite>( new Surface( "assets/background.png" ), 1 );
-	unique_ptr<Sprite> foreground_sprite = make_unique<Sprite>( new Surface( "assets/foreground.png" ), 1 );
-	unique_ptr<Sprite> info_sprite = make_unique<Sprite>( new Surface( "assets/info_background.png" ), 1 );
-	unique_ptr<Sprite> menuScreen_sprite = make_unique<Sprite>( new Surface( "assets/mainMenu.png" ), 1 );
-	unique_ptr<Sprite> cursorFlame_sprite = make_unique<Sprite>( new Surface( "assets/flameCursor.png" ), 10 );
-	unique_ptr<Sprite> crossHair_sprite = make_unique<Sprite>( new Surface( "assets/crosshair.png" ), 1 );
-	unique_ptr<Sprite> heart_sprite = make_unique<Sprite>( new Surface( "assets/heart.png" ), 1 );
+	/* Decoded as background jobs, they are set once published by the AssetManager */
+	shared_ptr<Sprite> player_sprite;
+	shared_ptr<Sprite> flame_sprite;
+	shared_ptr<Sprite> coalBasic_sprite;
+	shared_ptr<Sprite> coalBomb_sprite;
+	shared_ptr<Sprite> coalGold_sprite;
+	shared_ptr<Sprite> explosion_sprite;
+	shared_ptr<Sprite> fireball_sprite;
+	shared_ptr<Sprite> background_sprite;
+	shared_ptr<Sprite> foreground_sprite;
+	shared_ptr<Sprite> cursorFlame_sprite;
+	shared_ptr<Sprite> crossHair_sprite;
+	shared_ptr<Sprite> heart_sprite;
+
+	/* What the systems in Game::AddUpdateSystems() read and write */
+	enum class Resource
+	{
+		PLAYER,
+		BOOST,
+		GOLD_COAL,
+		BASIC_COALS,
+		BOMB_COALS,
+		FIREBALLS,
+		FLAMES,
+		EXPLOSIONS,
+		/* The separation grid, chase target and AI scheduler */
+		STEERING,
+		SFX
+	};
+
+	constexpr ResourceSet Uses( std::initializer_list<Resource> resources )
+	{
+		ResourceSet set{ 0 };
+		for (const Resource resource : resources) { set |= ResourceSet{ 1 } << static_cast<int>(resource); }
+		return set;
+	}
+
+	/* Returns the b of the first contact for which match( b ) is true */
+	/* The contacts are sorted, so that is the lowest matching index */
+	template <typename Match>
+	size_t FindFirstContact( ContactList::Range contacts, Match match )
+	{
+		for (const Contact& contact : contacts)
+		{
+			if (match( contact.b )) { return contact.b; }
+		}
+		return SpatialGrid::NONE;
+	}
+
+	/* Adds a contact for every pair of overlapping circles, the b circles are looked up in grid */
+	template <typename CircleOfA, typename CircleOfB>
+	void DetectInGrid( ContactList& list, size_t countA, const SpatialGrid& grid, CircleOfA circleOfA, CircleOfB circleOfB,
+		bool sameType = false )
+	{
+		for (size_t a = 0; a < countA; ++a)
+		{
+			const Circle circle = circleOfA( a );
+			grid.Query( circle, [&]( size_t b )
+			{
+				if (!(sameType && a == b) && DoCirclesOverlap( circle, circleOfB( b ) )) { list.Add( a, b ); }
+			} );
+		}
+	}
+
+	/* Steps the spawn and despawn frames of the coals whose frame timer expired */
+	/* A coal's timer keeps going until StepFrame() has nothing left to step */
+	/* With despawningOnly the other coals hold their frame, their timers are kept for when they despawn */
+	template <typename CoalType>
+	void StepCoalFrames( TimingWheel<PoolHandle>& timers, Pool<CoalType>& coals, float deltaTime,
+		bool despawningOnly = false )
+	{
+		timers.Advance( deltaTime, [&]( PoolHandle handle )
+		{
+			/* The coal can be gone already, its handle then no longer resolves */
+			CoalType* coal = coals.Get( handle );
+			if (!coal) { return; }
+
+			if ((despawningOnly && !coal->IsDespawning()) || coal->StepFrame())
+			{
+				timers.Schedule( CoalType::timeBetweenFrameUpdates, handle );
+			}
+		} );
+	}
+
+	/* Adds a contact for every circle in the batch that overlaps with the single entity b, like the player */
+	void DetectWithSingle( ContactList& list, const CircleBatch& batch, Circle b )
+	{
+		ForEachOverlap( b, batch, [&]( size_t a ) { list.Add( a, 0 ); } );
+	}
 
 	/* Constructor */
 	Game::Game( Surface* _screen )
 		: screen( _screen )
-		, sfx( volume_sprite )
-		, goldCoal( coalGold_sprite, { 0.0f, 0.0f }, coalRadius, globalSpeed )
-		, player( player_sprite, mushroom_sprite, { 0.0f, 0.0f }, playerRadius, globalSpeed )
+		, goldCoal( SpriteRegistry::NONE, { 0.0f, 0.0f }, coalRadius, globalSpeed )
+		, player( SpriteRegistry::NONE, nullptr, { 0.0f, 0.0f }, playerRadius, globalSpeed )
 		, playButton( 425, 625, 185, 50, "start", 5, -15, 0xffffff, 0x82ff79 )
 		, tryAgainButton( 449, 360, 250, 50, "try again", 4, -45, 0xffffff, 0x82ff79 )
 		, menuButton( 100, 360, 250, 50, "menu", 5, 15, 0xffffff, 0xffe98f )
@@ -46,24 +115,57 @@ namespace Tmpl8
 		, resumeButton( 274, 328, 250, 50, "resume", 5, -11, 0xffffff, 0x82ff79 )
 		, quitButton( 425, 690, 250, 50, "quit", 5, 15, 0xffffff, 0xff9079 )
 		, infoButton( 625, 625, 50, 50, "?", 5, 0, 0xffffff, 0xffe98f )
-	{}
+	{
+		/* Large sprites that are only loaded while needed */
+		menuScreenSprite = spriteCache.Register( "assets/mainMenu.png", 1, AssetGroup::MENU );
+		infoSprite = spriteCache.Register( "assets/info_background.png", 1, AssetGroup::STREAMED );
+		mushroomSprite = spriteCache.Register( "assets/mushroomMan.png", 60, AssetGroup::STREAMED );
+
+		/* Entity sprites are always resident, their slots are filled once they're loaded */
+		playerSpriteId = SpriteRegistry::Register();
+		flameSpriteId = SpriteRegistry::Register();
+		coalBasicSpriteId = SpriteRegistry::Register();
+		coalBombSpriteId = SpriteRegistry::Register();
+		coalGoldSpriteId = SpriteRegistry::Register();
+		explosionSpriteId = SpriteRegistry::Register();
+		fireballSpriteId = SpriteRegistry::Register();
+
+		/* The main menu's assets are queued first, so they are decoded first */
+		spriteCache.Prefetch( menuScreenSprite );
+		assets.LoadSprite( cursorFlame_sprite, "assets/flameCursor.png", 10, AssetGroup::MENU );
+		assets.LoadSprite( explosion_sprite, "assets/explosion.png", 8, AssetGroup::MENU );
+		sfx.Load( assets );
+
+		assets.LoadSprite( player_sprite, "assets/player.png", 60, AssetGroup::GAME );
+		assets.LoadSprite( flame_sprite, "assets/flame.png", 60, AssetGroup::GAME );
+		assets.LoadSprite( coalBasic_sprite, "assets/basicCoal.png", 8, AssetGroup::GAME );
+		assets.LoadSprite( coalBomb_sprite, "assets/bombCoal.png", 6, AssetGroup::GAME );
+		assets.LoadSprite( coalGold_sprite, "assets/goldCoal.png", 4, AssetGroup::GAME );
+		assets.LoadSprite( fireball_sprite, "assets/fireball.png", 1, AssetGroup::GAME );
+		assets.LoadSprite( background_sprite, "assets/background.png", 1, AssetGroup::GAME );
+		assets.LoadSprite( foreground_sprite, "assets/foreground.png", 1, AssetGroup::GAME );
+		assets.LoadSprite( crossHair_sprite, "assets/crosshair.png", 1, AssetGroup::GAME );
+		assets.LoadSprite( heart_sprite, "assets/heart.png", 1, AssetGroup::GAME );
+
+		AddUpdateSystems();
+	}
 
 	// -----------------------------------------------------------
 	// Initialize the application
 	// -----------------------------------------------------------
 	void Game::Init()
 	{
-		/* Set the volumes of the sound effects */
-		sfx.explosion.setVolume( 0.4f );
-		sfx.button.setVolume( 0.2f );
-		sfx.shoot.setVolume( 0.4f );
-		sfx.flash.setVolume( 0.8f );
-		sfx.gold.setVolume( 1.0f );
-		sfx.bounce.setVolume( 0.2f );
-		sfx.hurt.setVolume( 1.0f );
-		sfx.contact.setVolume( 1.0f );
-		sfx.hitCoal.setVolume( 0.4f );
-		sfx.dash.setVolume( 0.4f );
+		/* The assets queued by the constructor start loading as soon as the workers do, */
+		/* so the busy times are sized and the hook is set before that */
+		const unsigned int workerCount = JobSystem::DefaultWorkerCount();
+		jobBusyTime = std::vector<std::atomic<long long>>( workerCount + 1 );
+		jobBusyPerTick.assign( jobBusyTime.size(), 0 );
+		jobSystem.SetTimingHook( [this]( const JobTiming& timing )
+		{
+			const size_t index = Min( static_cast<size_t>(timing.worker), jobBusyTime.size() - 1 );
+			jobBusyTime[index] += std::chrono::duration_cast<std::chrono::nanoseconds>(timing.end - timing.start).count();
+		} );
+		jobSystem.Start( workerCount );
 
 		/* The default cursor is replaced with a custom one */
 		SDL_ShowCursor( false );
@@ -125,8 +227,38 @@ namespace Tmpl8
 		previousLeftPressed = LeftPressed;
 		LeftPressed = mouseDown;
 
+		/* Hand over the assets that finished loading since the last tick */
+		assets.Update();
+		if (!gameAssetsBound && assets.IsReady( AssetGroup::GAME )) { BindGameAssets(); }
+		spriteCache.Update();
+		if (gameState != previousGameState)
+		{
+			OnGameStateChanged();
+			previousGameState = gameState;
+		}
+
 		switch (gameState)
 		{
+			//----------------------------------------------//
+			// Loading screen                               //
+			// accessed on startup until the menu is loaded //
+			//----------------------------------------------//
+		case GameState::LOADING:
+
+			/* A simple progress bar, the sprites it would use aren't loaded yet */
+			screen->Clear( 0x1f161b );
+			screen->Print( "loading", 295, 330, 0xffffff, 5 );
+			screen->Box( 200, 380, 599, 409, 0xffffff );
+			screen->Bar( 202, 382, 202 + static_cast<int>(395.0f * assets.GetProgress()), 407, 0xfd5f44 );
+
+			if (assets.IsReady( AssetGroup::MENU ))
+			{
+				BindMenuAssets();
+				gameState = GameState::MENU;
+			}
+
+			break;
+
 			//-----------------------------------------------------------//
 			// Main menu screen                                          //
 			// accessed on startup or via a button on the game over menu //
@@ -144,7 +276,7 @@ namespace Tmpl8
 			}
 
 			/* Draw menu screen background */
-			menuScreen_sprite->Draw( screen, 0, 0 );
+			spriteCache.Get( menuScreenSprite )->Draw( screen, 0, 0, 0 );
 
 			/* Update and draw the buttons */
 			/* (!previousLeftPressed && leftPressed) is true when the left... */
@@ -153,7 +285,7 @@ namespace Tmpl8
 			playButton.Update( deltaTime, mousex, mousey, (!previousLeftPressed && LeftPressed) );
 			quitButton.Update( deltaTime, mousex, mousey, (!previousLeftPressed && LeftPressed) );
 			infoButton.Update( deltaTime, mousex, mousey, (!previousLeftPressed && LeftPressed) );
-			for (auto& e : explosions) { e.Update( deltaTime ); }
+			UpdateExplosions( deltaTime );
 
 			playButton.Draw( screen );
 			quitButton.Draw( screen );
@@ -179,32 +311,32 @@ namespace Tmpl8
 				{
 					flameCursorFrame = 0;
 				}
-				cursorFlame_sprite->SetFrame( flameCursorFrame );
 				flameCursorTimer = flameCursorSwitchTime;
 			}
-			cursorFlame_sprite->Draw( screen, mousex - 11, mousey - 37 );
+			cursorFlame_sprite->Draw( screen, mousex - 11, mousey - 37, flameCursorFrame );
 
 			// Only change game state when the volume is not being modified
 			if (!sfx.CurrentlyModifyingVolume())
 			{
 				if (playButton.IsPressed())
 				{
+					WaitForGameAssets();
 					gameState = GameState::GAME;
 					gameStartedViaMenu = true;
 					playerAlive = true;
-					explosions.clear();
+					explosions.Clear();
 
 					/* Play the button sound effect */
-					sfx.button.replay();
+					sfx.Play( SFX::Effect::BUTTON );
 				}
 				else if (infoButton.IsPressed())
 				{
 					gameState = GameState::INFO;
 					menuButton.SetPos( 275, 25 );
-					explosions.clear();
+					explosions.Clear();
 
 					/* Play the button sound effect */
-					sfx.button.replay();
+					sfx.Play( SFX::Effect::BUTTON );
 				}
 				else if (quitButton.IsPressed())
 				{
@@ -213,18 +345,19 @@ namespace Tmpl8
 				}
 				else if (secretMode)
 				{
+					WaitForGameAssets();
 					gameState = GameState::SECRET_MODE;
 					gameStartedViaMenu = true;
 					ResetGameVariables();
 					SetUpSecretMode();
 					playerAlive = true;
-					player.ActivateMushroomMan();
-					explosions.clear();
+					player.ActivateMushroomMan( spriteCache.Get( mushroomSprite ) );
+					explosions.Clear();
 
 					/* The screen flashes when entering the secret game mode */
 					flashTimer = maxFlashTime;
 					/* Play a sound effect */
-					sfx.flash.replay();
+					sfx.Play( SFX::Effect::FLASH );
 				}
 			}
 
@@ -242,10 +375,10 @@ namespace Tmpl8
 				(mousex >= 209 && mousex <= 250) && (mousey >= 602 && mousey <= 643))
 			{
 				drawHitBox = !drawHitBox;
-				sfx.button.replay();
+				sfx.Play( SFX::Effect::BUTTON );
 			}
 
-			info_sprite->Draw( screen, 0, 0 );
+			spriteCache.Get( infoSprite )->Draw( screen, 0, 0, 0 );
 
 			menuButton.Update( deltaTime, mousex, mousey, (!previousLeftPressed && LeftPressed) );
 
@@ -259,10 +392,9 @@ namespace Tmpl8
 				{
 					flameCursorFrame = 0;
 				}
-				cursorFlame_sprite->SetFrame( flameCursorFrame );
 				flameCursorTimer = flameCursorSwitchTime;
 			}
-			cursorFlame_sprite->Draw( screen, mousex - 11, mousey - 37 );
+			cursorFlame_sprite->Draw( screen, mousex - 11, mousey - 37, flameCursorFrame );
 
 			if (menuButton.IsPressed())
 			{
@@ -270,24 +402,25 @@ namespace Tmpl8
 				menuButton.SetPos( 100, 360 );
 
 				/* Play the button sound effect */
-				sfx.button.replay();
+				sfx.Play( SFX::Effect::BUTTON );
 			}
 			else if (secretMode)
 			{
+				WaitForGameAssets();
 				gameState = GameState::SECRET_MODE;
 				gameStartedViaMenu = true;
 				ResetGameVariables();
 				SetUpSecretMode();
 				playerAlive = true;
-				player.ActivateMushroomMan();
-				explosions.clear();
+				player.ActivateMushroomMan( spriteCache.Get( mushroomSprite ) );
+				explosions.Clear();
 
 				menuButton.SetPos( 100, 360 );
 
 				/* The screen flashes when entering the secret game mode */
 				flashTimer = maxFlashTime;
 				/* Play a sound effect */
-				sfx.flash.replay();
+				sfx.Play( SFX::Effect::FLASH );
 			}
 
 			break;
@@ -344,7 +477,7 @@ namespace Tmpl8
 				screen->Print( ("score:" + std::to_string( displayedScore )).c_str(), 530, 17, 0xffffff, 4 );
 			}
 			/* Setting the cross hair's color manually, otherwise it doesn't draw the correct color */
-			crossHair_sprite->DrawInColor( screen, mousex - 11, mousey - 11, 0x1f161b );
+			crossHair_sprite->DrawInColor( screen, mousex - 11, mousey - 11, 0, 0x1f161b );
 			if (drawHitBox) { DrawEntityHitBox(); }
 			if (flashTimer > 0.0f) { screen->Clear( 0xedcd72, flashTimer / maxFlashTime ); }
 
@@ -352,6 +485,7 @@ namespace Tmpl8
 			if (player.GetHitPoints() == 0)
 			{
 				gameState = GameState::GAME_OVER;
+				sequences.Start( GameOverSequence() );
 				regularGameOver = true;
 				player.SetBoostState( false );
 				gameStartedViaMenu = false;
@@ -368,7 +502,7 @@ namespace Tmpl8
 				quitButton.SetPos( 274, 458 );
 
 				/* Play the button sound effect */
-				sfx.button.replay();
+				sfx.Play( SFX::Effect::BUTTON );
 			}
 
 			break;
@@ -418,7 +552,7 @@ namespace Tmpl8
 			menuButton.Draw( screen );
 			quitButton.Draw( screen );
 			/* Draw the cross hair white so it is better visible against the darkened background */
-			crossHair_sprite->DrawInColor( screen, mousex - 11, mousey - 11, 0xffffff );
+			crossHair_sprite->DrawInColor( screen, mousex - 11, mousey - 11, 0, 0xffffff );
 			if (flashTimer > 0.0f) { screen->Clear( 0xedcd72, flashTimer / maxFlashTime ); }
 
 			if (resumeButton.IsPressed())
@@ -437,28 +571,29 @@ namespace Tmpl8
 				menuButton.SetPos( 100, 360 );
 
 				/* Play the button sound effect */
-				sfx.button.replay();
+				sfx.Play( SFX::Effect::BUTTON );
 			}
 			else if (menuButton.IsPressed())
 			{
 				gameState = GameState::MENU;
 				secretMode = false;
+				player.DeactivateMushroomMan();
 				menuButton.SetPos( 100, 360 );
 				quitButton.SetPos( 425, 690 );
 				player.SetPosX( static_cast<float>(ScreenWidth) / 2.0f );
 				player.SetPosY( static_cast<float>(ScreenHeight) / 2.0f );
 				player.SetBoostState( false );
 
-				flames.clear();
-				basicCoals.clear();
-				bombCoals.clear();
-				fireballs.clear();
-				explosions.clear();
+				flames.Clear();
+				basicCoals.Clear();
+				bombCoals.Clear();
+				fireballs.Clear();
+				explosions.Clear();
 				goldCoal.SetActive( false );
 				ResetGameVariables();
 
 				/* Play the button sound effect */
-				sfx.button.replay();
+				sfx.Play( SFX::Effect::BUTTON );
 			}
 			else if (quitButton.IsPressed())
 			{
@@ -474,19 +609,17 @@ namespace Tmpl8
 			//--------------------------------------------------//
 		case GameState::GAME_OVER:
 
-			/* Adjusts the necessary timer(s) */
-			timeSinceGameOver += deltaTime;
-
 			/* Update objects some objects (except coals) */
-			for (auto& fBall : fireballs) { fBall.Update( deltaTime ); }
+			UpdateFireballs( deltaTime );
 			UpdateBounceSFX();
 			for (auto& flame : flames) { if (flame.IsActive()) { flame.Update( deltaTime ); } }
-			for (auto& exp : explosions) { exp.Update( deltaTime ); }
+			UpdateExplosions( deltaTime );
 			player.Update( deltaTime, mousex, mousey );
 
 			/* Change immunity timer to > 0 so the player doesn't "take damage" from explosions */
 			playerImmunityTimer = 1.0f;
 			UpdateDespawnCoals( deltaTime );
+			ClampCoalsToWalls();
 			DoCollision();
 			/* Change immunity to 0 again so the player isn't drawn as if it were immune */
 			playerImmunityTimer = 0.0f;
@@ -515,28 +648,16 @@ namespace Tmpl8
 				screen->Print( "  ERROR", 530, 17, 0xffffff, 4 );
 			}
 			/* Setting the cross hair's color manually, otherwise it doesn't draw the correct color */
-			crossHair_sprite->DrawInColor( screen, mousex - 11, mousey - 11, 0x1f161b );
+			crossHair_sprite->DrawInColor( screen, mousex - 11, mousey - 11, 0, 0x1f161b );
 			if (drawHitBox) { DrawEntityHitBox(); }
 
-			if (timeSinceGameOver > 1.5f)
+			/* The coals killed by GameOverSequence() still play their death animation */
+			if (killedEnemies)
 			{
 				for (auto& basic : basicCoals) { if (basic.IsDead()) { basic.Update( deltaTime, *this ); } }
-				if (!killedEnemies) { KillEnemies(); }
-			}
-			if (timeSinceGameOver > 2.5f)
-			{
-				if (MovePlayerTowardsCenter())
-				{
-					/* Only change the game mode once the player has reached the center */
-					gameState = GameState::GAME_OVER_MENU;
-
-					killedEnemies = false;
-					/* Update the high score when necessary*/
-					if (regularGameOver) { UpdateHighScore(); }
-					if (newHighScore) { scoreFlashTimer = maxScoreFlashTime; }
-					timeSinceGameOver = 0.0f;
-				}
+				ClampCoalsToWalls();
 			}
+			sequences.Update( deltaTime );
 
 			break;
 
@@ -557,6 +678,7 @@ namespace Tmpl8
 			menuButton.Update( deltaTime, mousex, mousey, (!previousLeftPressed && LeftPressed) );
 			player.Update( deltaTime, mousex, mousey );
 			UpdateDespawnCoals( deltaTime );
+			ClampCoalsToWalls();
 
 			DrawScreen();
 			if (drawHitBox) { DrawEntityHitBox(); }
@@ -612,7 +734,7 @@ namespace Tmpl8
 				screen->Print( "  ERROR", 530, 17, 0xffffff, 4 );
 			}
 			/* Setting the cross hair's color manually, otherwise it doesn't draw the correct color */
-			crossHair_sprite->DrawInColor( screen, mousex - 11, mousey - 11, 0x1f161b );
+			crossHair_sprite->DrawInColor( screen, mousex - 11, mousey - 11, 0, 0x1f161b );
 
 			if (tryAgainButton.IsPressed())
 			{
@@ -622,7 +744,7 @@ namespace Tmpl8
 				playerAlive = true;
 
 				/* Play the button sound effect */
-				sfx.button.replay();
+				sfx.Play( SFX::Effect::BUTTON );
 			}
 			else if (menuButton.IsPressed())
 			{
@@ -632,7 +754,7 @@ namespace Tmpl8
 				quitButton.SetPos( 425, 690 );
 
 				/* Play the button sound effect */
-				sfx.button.replay();
+				sfx.Play( SFX::Effect::BUTTON );
 			}
 			else if (secretMode)
 			{
@@ -641,12 +763,12 @@ namespace Tmpl8
 				ResetGameVariables();
 				SetUpSecretMode();
 				playerAlive = true;
-				player.ActivateMushroomMan();
+				player.ActivateMushroomMan( spriteCache.Get( mushroomSprite ) );
 
 				/* The screen flashes when entering the secret game mode */
 				flashTimer = maxFlashTime;
 				/* Play a sound effect */
-				sfx.flash.replay();
+				sfx.Play( SFX::Effect::FLASH );
 			}
 
 			break;
@@ -683,17 +805,18 @@ namespace Tmpl8
 			/* Print the score (in the secret mode it displays ERROR instead) */
 			screen->Print( "  ERROR", 530, 17, 0xffffff, 4 );
 			/* Setting the cross hair's color manually, otherwise it doesn't draw the correct color */
-			crossHair_sprite->DrawInColor( screen, mousex - 11, mousey - 11, 0x1f161b );
+			crossHair_sprite->DrawInColor( screen, mousex - 11, mousey - 11, 0, 0x1f161b );
 			if (drawHitBox) { DrawEntityHitBox(); }
 			if (flashTimer > 0.0f) { screen->Clear( 0xffffff, flashTimer / maxFlashTime ); }
 
 			/* Change the game state if the player has no hit points left or all enemies died */
 			/* or when there is only a single leftover fireball */
 			if (player.GetHitPoints() == 0 || AllEnemiesDead() ||
-				(basicCoals.empty() && bombCoals.empty() &&
-					fireballs.size() == 1 && !goldCoal.IsActive()))
+				(basicCoals.Empty() && bombCoals.Empty() &&
+					fireballs.Size() == 1 && !goldCoal.IsActive()))
 			{
 				gameState = GameState::GAME_OVER;
+				sequences.Start( GameOverSequence() );
 				regularGameOver = false;
 				secretMode = false;
 
@@ -715,11 +838,16 @@ namespace Tmpl8
 				quitButton.SetPos( 274, 458 );
 
 				/* Play the button sound effect */
-				sfx.button.replay();
+				sfx.Play( SFX::Effect::BUTTON );
 			}
 
 			break;
 		}
+
+		if (drawJobTimes) { DrawJobTimes( deltaTime ); }
+
+		/* Start the sounds requested during this tick */
+		sfx.Flush();
 	}
 
 	void Game::UpdateAndManageCoalSpawning( float deltaTime )
@@ -736,8 +864,10 @@ namespace Tmpl8
 			timeBetweenGoldSpawnUpdates = maxTimeBetweenGoldSpawnUpdates;
 		}
 
-		const int totalCoals = static_cast<int>(basicCoals.size() + bombCoals.size());
-		const int totalFireballs = static_cast<int>(fireballs.size());
+		UpdateSpawnGrids();
+
+		const int totalCoals = static_cast<int>(basicCoals.Size() + bombCoals.Size());
+		const int totalFireballs = static_cast<int>(fireballs.Size());
 		const int totalEnemies = totalCoals + totalFireballs;
 
 		/* Determine if a goldCoal should be activated */
@@ -775,32 +905,8 @@ namespace Tmpl8
 
 				++positionsGenerated;
 
-				bool fail{ false };
-				/* Go over the explosions to check if the position is valid */
-				for (auto& e : explosions)
-				{
-					/* If the generated position is too close to a coal */
-					if (GetSquaredDist( e.GetPos(), { x, y } ) < (goldSpawnDistDanger * goldSpawnDistDanger))
-					{
-						/* Break from the for loop if a single coal is too close*/
-						fail = true;
-						break;
-					}
-				}
-				if (fail) { continue; }
-
-				/* Go over the fireballs to check if the position is valid */
-				for (auto& f : fireballs)
-				{
-					/* If the generated position is too close to a coal */
-					if (GetSquaredDist( f.GetPos(), { x, y } ) < (goldSpawnDistDanger * goldSpawnDistDanger))
-					{
-						/* Break from the for loop if a single coal is too close*/
-						fail = true;
-						break;
-					}
-				}
-				if (fail) { continue; }
+				/* The position is invalid if an explosion or fireball is too close */
+				if (!goldSpawnGrid.IsFree( { x, y } )) { continue; }
 
 				if (GetSquaredDist( player.GetPos(), { x, y } ) < (goldSpawnDist * goldSpawnDist))
 				{
@@ -847,58 +953,15 @@ namespace Tmpl8
 				}
 			}
 
-			float x, y;
-			/* Stop generating positions after a certain number to avoid infinite loop */
-			int positionsGenerated = 0;
-			bool invalidPos = true;
-			/* Search for a valid position (at random) */
-			do
+			/* Pick a random position away from the other coals and the player */
+			vec2 spawnPos;
+			if (!coalSpawnGrid.Sample( rng, spawnPos ))
 			{
-				/* Generate a random position */
-				x = static_cast<float>(rand_x( rng ));
-				y = static_cast<float>(rand_y( rng ));
-				++positionsGenerated;
-
-				bool fail{ false };
-				/* Go over the basic coals to check if the position is valid */
-				for (auto& c : basicCoals)
-				{
-					/* If the generated position is too close to a coal */
-					if (GetSquaredDist(c.GetPos(), {x, y}) < (coalSpawnDist * coalSpawnDist))
-					{
-						/* Break from the for loop if a single coal is too close*/
-						fail = true;
-						break;
-					}
-				}
-				if (fail) { continue; }
-
-				/* Go over the bomb coals to check if the position is valid */
-				for (auto& c : bombCoals)
-				{
-					/* If the generated position is too close to a coal */
-					if (GetSquaredDist( c.GetPos(), { x, y } ) < (coalSpawnDist * coalSpawnDist))
-					{
-						/* Break from the for loop if a single coal is too close*/
-						fail = true;
-						break;
-					}
-				}
-				if (fail) { continue; }
-
-				/* See if the generated position is valid based on the player's position */
-				if (GetSquaredDist(player.GetPos(), {x, y}) < (coalSpawnDist * coalSpawnDist))
-				{
-					/* if invalid position */
-					continue;
-				}
-				else
-				{
-					/* The position is valid */
-					invalidPos = false;
-				}
-
-			} while (invalidPos && positionsGenerated <= 50);
+				/* The arena is full, spawn anywhere */
+				spawnPos = { static_cast<float>(rand_x( rng )), static_cast<float>(rand_y( rng )) };
+			}
+			const float x = spawnPos.x;
+			const float y = spawnPos.y;
 
 			/* Decide to spawn a BasicCoal or BombCoal */
 			if (rand_100(rng) <= basicCoalPercentage[percentageIndex])
@@ -925,78 +988,127 @@ namespace Tmpl8
 
 	void Game::UpdateObjects(float deltaTime)
 	{
-		/* Update (most) objects */
-		if (goldCoal.IsActive())							{ goldCoal.Update( deltaTime ); }
-		for (auto& coal : basicCoals)						{ coal.Update( deltaTime, *this ); }
-		for (auto& coal : bombCoals)						{ coal.Update( deltaTime, *this ); }
-		for (auto& fBall : fireballs)						{ fBall.Update( deltaTime ); }
-		for (auto& flame : flames) { if (flame.IsActive())	{ flame.Update( deltaTime ); } }
-		for (auto& exp : explosions)						{ exp.Update( deltaTime ); }
-		
-		/* Update the player position and direction based on input and mouse position */
-		if (boost && boostCooldown <= 0 && (up || down || left || right))
-		{
-			player.SetBoostState( true );
-			boostLength = 0.2f;
-			boostCooldown = maxBoostCooldown;
+		updateSystems.Run( deltaTime );
+	}
 
-			/* Play a sound effect */
-			sfx.dash.replay();
-		}
-		if (boostLength > 0)
+	void Game::AddUpdateSystems()
+	{
+		/* Reads the player's position before the player system (in a later wave) moves it, */
+		/* so the coals chase where the player was at the start of the tick */
+		updateSystems.Add( Uses( { Resource::PLAYER, Resource::GOLD_COAL, Resource::BASIC_COALS, Resource::BOMB_COALS } ),
+			Uses( { Resource::STEERING } ), [this]( float )
 		{
-			boostLength -= deltaTime;
+			BuildSeparationGrid();
+			chaseTarget.Update( player.GetPos() );
+			aiScheduler.BeginTick( player.GetPos(), goldCoal.IsActive(), goldCoal.GetPos() );
+		} );
 
-			if (boostLength < 0)
-			{
-				player.SetBoostState( false );
-			}
-		}
-		
-		if (up)		player.SetMovement( 0, -1 );
-		if (left)	player.SetMovement( -1, 0 );
-		if (down)	player.SetMovement( 0, 1 );
-		if (right)	player.SetMovement( 1, 0 );
+		updateSystems.Add( 0, Uses( { Resource::GOLD_COAL } ), [this]( float deltaTime )
+		{
+			if (goldCoal.IsActive()) { goldCoal.Update( deltaTime ); }
+		} );
 
-		player.Update( deltaTime, mousex, mousey );
-	}
+		/* The coals' separation reads the positions of both kinds of coals */
+		updateSystems.Add( Uses( { Resource::STEERING, Resource::GOLD_COAL, Resource::BOMB_COALS } ),
+			Uses( { Resource::BASIC_COALS } ), [this]( float deltaTime )
+		{
+			StepCoalFrames( basicCoalTimers, basicCoals, deltaTime );
+			for (auto& coal : basicCoals) { coal.Update( deltaTime, *this ); }
+		} );
+		updateSystems.Add( Uses( { Resource::STEERING, Resource::GOLD_COAL, Resource::BASIC_COALS } ),
+			Uses( { Resource::BOMB_COALS } ), [this]( float deltaTime )
+		{
+			StepCoalFrames( bombCoalTimers, bombCoals, deltaTime );
+			for (auto& coal : bombCoals) { coal.Update( deltaTime, *this ); }
+		} );
+		updateSystems.Add( 0, Uses( { Resource::FIREBALLS } ), [this]( float deltaTime )
+		{
+			UpdateFireballs( deltaTime );
+		} );
+		updateSystems.Add( 0, Uses( { Resource::FLAMES } ), [this]( float deltaTime )
+		{
+			for (auto& flame : flames) { if (flame.IsActive()) { flame.Update( deltaTime ); } }
+		} );
+		updateSystems.Add( 0, Uses( { Resource::EXPLOSIONS } ), [this]( float deltaTime )
+		{
+			UpdateExplosions( deltaTime );
+		} );
 
-	void Game::UpdateDespawnCoals( float deltaTime )
-	{
-		/* Basic Coals */
-		for (auto basic = basicCoals.begin(); basic < basicCoals.end();)
+		/* Update the player position and direction based on input and mouse position */
+		updateSystems.Add( 0, Uses( { Resource::PLAYER, Resource::BOOST, Resource::SFX } ), [this]( float deltaTime )
 		{
-			if (basic->IsDespawned())
+			if (boost && boostCooldown <= 0 && (up || down || left || right))
 			{
-				basic = basicCoals.erase( basic );
-				break;
+				player.SetBoostState( true );
+				boostLength = 0.2f;
+				boostCooldown = maxBoostCooldown;
+
+				/* Play a sound effect */
+				sfx.Play( SFX::Effect::DASH );
 			}
-			else
+			if (boostLength > 0)
 			{
-				if (basic->IsDespawning())
+				boostLength -= deltaTime;
+
+				if (boostLength < 0)
 				{
-					basic->Update( deltaTime, *this );
+					player.SetBoostState( false );
 				}
-				++basic;
 			}
-		}
-		/* Bomb Coals */
-		for (auto bomb = bombCoals.begin(); bomb < bombCoals.end();)
+
+			if (up)		player.SetMovement( 0, -1 );
+			if (left)	player.SetMovement( -1, 0 );
+			if (down)	player.SetMovement( 0, 1 );
+			if (right)	player.SetMovement( 1, 0 );
+
+			player.Update( deltaTime, mousex, mousey );
+		} );
+	}
+
+	void Game::BuildSeparationGrid()
+	{
+		separationGrid.Clear();
+		for (const auto& coal : basicCoals) { separationGrid.Insert( { coal.GetPos(), 0.0f } ); }
+		for (const auto& coal : bombCoals) { separationGrid.Insert( { coal.GetPos(), 0.0f } ); }
+		separationGrid.Build();
+	}
+
+	void Game::UpdateExplosions( float deltaTime )
+	{
+		explosionTimers.Advance( deltaTime, [this]( PoolHandle handle )
 		{
-			if (bomb->IsDespawned())
-			{
-				bomb = bombCoals.erase( bomb );
-				break;
-			}
-			else
-			{
-				if (bomb->IsDespawning())
-				{
-					bomb->Update( deltaTime, *this );
-				}
-				++bomb;
-			}
-		}
+			/* The explosion can be gone already, its handle then no longer resolves */
+			Explosion* explosion = explosions.Get( handle );
+			if (!explosion) { return; }
+
+			explosion->NextFrame();
+			if (explosion->IsActive()) { explosionTimers.Schedule( Explosion::timeBetweenFrames, handle ); }
+		} );
+	}
+
+	void Game::UpdateFireballs( float deltaTime )
+	{
+		/* The trails store the position from before the move */
+		for (auto& fBall : fireballs) { fBall.Update( deltaTime ); }
+
+		IntegrateAndReflect( fireballMotion, deltaTime, walls );
+	}
+
+	void Game::ClampCoalsToWalls()
+	{
+		ClampToWalls( basicCoalMotion, walls );
+		ClampToWalls( bombCoalMotion, walls );
+	}
+
+	void Game::UpdateDespawnCoals( float deltaTime )
+	{
+		/* Basic Coals */
+		basicCoals.RemoveIf( []( const CoalBasic& basic ) { return basic.IsDespawned(); } );
+		StepCoalFrames( basicCoalTimers, basicCoals, deltaTime, true );
+
+		/* Bomb Coals */
+		bombCoals.RemoveIf( []( const CoalBomb& bomb ) { return bomb.IsDespawned(); } );
+		StepCoalFrames( bombCoalTimers, bombCoals, deltaTime, true );
 	}
 
 	void Game::UpdateDisplayScore( float deltaTime )
@@ -1017,50 +1129,34 @@ namespace Tmpl8
 
 	void Game::UpdateBounceSFX()
 	{
-		/* If at least one fireball just hit a wall, play a "bounce" sound */
+		/* Play a "bounce" sound for every fireball that just hit a wall, they are merged into one */
 		for (auto& f : fireballs)
 		{
-			if (f.IsHittingWall())
-			{
-				sfx.bounce.replay();
-				break;
-			}
+			if (f.IsHittingWall()) { sfx.Play( SFX::Effect::BOUNCE ); }
 		}
 	}
 
 	void Game::DoCollision()
 	{
 		/* Delete inactive coals, explosions and flames */
-		for (auto basic = basicCoals.begin(); basic < basicCoals.end();)
-		{
-			if (basic->IsDespawned()) { basic = basicCoals.erase( basic ); }
-			else { ++basic; }
-		}
-		for (auto exp = explosions.begin(); exp < explosions.end();)
-		{
-			if (!exp->IsActive()) { exp = explosions.erase( exp ); }
-			else { ++exp; }
-		}
-		for (auto flame = flames.begin(); flame < flames.end();)
-		{
-			if (!flame->IsActive()) { flame = flames.erase( flame ); }
-			else { ++flame; }
-		}
+		basicCoals.RemoveIf( []( const CoalBasic& basic ) { return basic.IsDespawned(); } );
+		explosions.RemoveIf( []( const Explosion& exp ) { return !exp.IsActive(); } );
+		flames.RemoveIf( []( const Flame& flame ) { return !flame.IsActive(); } );
 
 		/* goldCoal with player collision (regardless of immunity) */
 		/* Check for overlap */
 		if (goldCoal.IsActive() && DoCirclesOverlap( player.GetCircle(), goldCoal.GetCircle()))
 		{
 			/* Grant points for all coal enemies*/
-			score += points * static_cast<int>(basicCoals.size());
-			score += points * static_cast<int>(bombCoals.size());
+			score += points * static_cast<int>(basicCoals.Size());
+			score += points * static_cast<int>(bombCoals.Size());
 
 			/* Remove all enemies */
 			goldCoal.SetActive( false );
-			basicCoals.clear();
-			bombCoals.clear();
-			fireballs.clear();
-			explosions.clear();
+			basicCoals.Clear();
+			bombCoals.Clear();
+			fireballs.Clear();
+			explosions.Clear();
 
 			goldDiedByPlayer = true;
 			/* Flash the screen gold */
@@ -1074,64 +1170,53 @@ namespace Tmpl8
 			player.SetHitByGoldCoal();
 
 			/* Play a sound effect */
-			sfx.gold.replay();
+			sfx.Play( SFX::Effect::GOLD );
 
 			/* return to avoid redundant collision checks */
 			return;
 		}
 
+		/* Entities are only tested against those in nearby grid cells */
+		/* They are flagged instead of erased, so their indices stay valid, and erased at the end */
+		BuildCollisionGrids();
+
+		/* Find every overlap first, then apply the collision rules below in a fixed order */
+		/* The explosions are detected later, as the rules below add new ones */
+		DetectContacts( {	ContactPair::FIREBALL_FIREBALL, ContactPair::FIREBALL_FLAME, ContactPair::FIREBALL_PLAYER,
+							ContactPair::FIREBALL_BOMB, ContactPair::FIREBALL_BASIC, ContactPair::FIREBALL_GOLD,
+							ContactPair::BOMB_PLAYER, ContactPair::BOMB_FLAME,
+							ContactPair::BASIC_PLAYER, ContactPair::BASIC_FLAME, ContactPair::GOLD_FLAME } );
+
 		/*====================*\
 		|| Fireball collision ||
 		\*====================*/
-		for (auto fBall = fireballs.begin(); fBall < fireballs.end();)
+		for (size_t i = 0; i < fireballs.Size(); ++i)
 		{
 			/* Don't check collision if the fireball is about to be erased */
-			if (fBall->IsToBeErased()) { ++fBall; continue; }
-
-			/* Keeps track off if the current fireball was erased */
-			bool erased = false;
+			if (fireballs[i].IsToBeErased()) { continue; }
 
 			/* Fireball with Fireball collision */
-			for (auto target = fireballs.begin(); target < fireballs.end(); ++target)
+			/* Fireballs that are about to be erased can still be hit, the one earliest in the vector is */
+			const size_t target = FindFirstContact( GetContacts( ContactPair::FIREBALL_FIREBALL ).Of( i ), [&]( size_t j ) { return !removedFireballs[j]; } );
+			if (target != SpatialGrid::NONE)
 			{
-				/* Check for overlap */
-				if (fBall != target &&
-					DoCirclesOverlap(fBall->GetCircle(), target->GetCircle()))
-				{
-					AddExplosion( (fBall->GetPos() + target->GetPos()) / 2.0f );
-					fBall->SetErase();
-					target->SetErase();
-					erased = true;
-					/* There still needs to be an increment because */
-					/* the fireball has technically not been erased yet */
-					++fBall;
-
-					/* Break because the current fireball should not */
-					/* undergo any more collisions */
-					break;
-				}
+				AddExplosion( (fireballs[i].GetPos() + fireballs[target].GetPos()) / 2.0f );
+				fireballs[i].SetErase();
+				fireballs[target].SetErase();
 
+				/* continue because the current fireball should not */
+				/* undergo any more collisions */
+				continue;
 			}
-			if (erased) { continue; }
 
 			/* Fireball with flame collision */
-			for (auto flame = flames.begin(); flame < flames.end();)
-			{
-				/* Check for overlap */
-				if (DoCirclesOverlap(fBall->GetCircle(), flame->GetCircle()))
-				{
-					flame = flames.erase( flame );
-				}
-				else
-				{
-					++flame;
-				}
-			}
+			for (const Contact& contact : GetContacts( ContactPair::FIREBALL_FLAME ).Of( i )) { removedFlames[contact.b] = true; }
+
 			/* Fireball with player collision */
-			if (DoCirclesOverlap(fBall->GetCircle(), player.GetCircle()))
+			if (!GetContacts( ContactPair::FIREBALL_PLAYER ).Of( i ).Empty())
 			{
 				AddExplosion( player.GetPos() );
-				fBall = fireballs.erase( fBall );
+				removedFireballs[i] = true;
 
 				/* continue because the current fireball should not */
 				/* undergo any more collisions */
@@ -1139,91 +1224,63 @@ namespace Tmpl8
 			}
 
 			/* Fireball with bombCoal collision */
-			for (auto bomb = bombCoals.begin(); bomb < bombCoals.end();)
+			const size_t bomb = FindFirstContact( GetContacts( ContactPair::FIREBALL_BOMB ).Of( i ), [&]( size_t j )
 			{
-				/* Check for overlap */
-				if (!bomb->IsInvincible() && DoCirclesOverlap(fBall->GetCircle(), bomb->GetCircle()))
-				{
-					AddExplosion( bomb->GetPos() );
-					bombCoals.erase( bomb );
-					fBall = fireballs.erase( fBall );
-					erased = true;
-
-					/* Break because the current fireball should not */
-					/* undergo any more collisions */
-					break;
-				}
-				else
-				{
-					++bomb;
-				}
+				return !removedBombs[j] && !bombCoals[j].IsInvincible();
+			} );
+			if (bomb != SpatialGrid::NONE)
+			{
+				AddExplosion( bombCoals[bomb].GetPos() );
+				removedBombs[bomb] = true;
+				removedFireballs[i] = true;
+				continue;
 			}
-			if (erased) { continue; }
 
 			/* Fireball with basicCoal collision */
-			for (auto basic = basicCoals.begin(); basic < basicCoals.end();)
+			const size_t basic = FindFirstContact( GetContacts( ContactPair::FIREBALL_BASIC ).Of( i ), [&]( size_t j )
 			{
-				/* Check for overlap */
-				if (!basic->IsInvincible() && DoCirclesOverlap(fBall->GetCircle(), basic->GetCircle()))
-				{
-					AddExplosion( basic->GetPos() );
-					basicCoals.erase( basic );
-					fBall = fireballs.erase( fBall );
-					erased = true;
-
-					/* Break because the current fireball should not */
-					/* undergo any more collisions */
-					break;
-				}
-				else
-				{
-					++basic;
-				}
+				return !removedBasics[j] && !basicCoals[j].IsInvincible();
+			} );
+			if (basic != SpatialGrid::NONE)
+			{
+				AddExplosion( basicCoals[basic].GetPos() );
+				removedBasics[basic] = true;
+				removedFireballs[i] = true;
+				continue;
 			}
-			if (erased) { continue; }
 
 			/* Fireball with goldCoal collision */
-			if (goldCoal.IsActive() &&
-				DoCirclesOverlap(fBall->GetCircle(), goldCoal.GetCircle()))
+			if (goldCoal.IsActive() && !GetContacts( ContactPair::FIREBALL_GOLD ).Of( i ).Empty())
 			{
 				AddExplosion( goldCoal.GetPos() );
 				goldCoal.SetActive( false );
-				fBall = fireballs.erase( fBall );
-
-				continue;
+				removedFireballs[i] = true;
 			}
-
-			/* Only increment if the current fireball wasn't erased */
-			if (!erased) { ++fBall; }
 		}
 
 		/* Safely erases Fireballs from their vector */
-		fireballs.erase( std::remove_if( fireballs.begin(), fireballs.end(),
-			[]( Fireball& f ) { return f.IsToBeErased(); } ), fireballs.end() );
+		for (size_t i = 0; i < fireballs.Size(); ++i)
+		{
+			if (fireballs[i].IsToBeErased()) { removedFireballs[i] = true; }
+		}
+		fireballs.RemoveFlagged( removedFireballs );
 
 		/*====================*\
 		|| BombCoal collision ||
 		\*====================*/
-		for (auto bomb = bombCoals.begin(); bomb < bombCoals.end();)
+		for (size_t i = 0; i < bombCoals.Size(); ++i)
 		{
-			/* Keeps track off if the current bombCoal was erased */
-			bool erased = false;
-
-			/* Don't check collision if the coal is invincible */
-			if (bomb->IsInvincible())
-			{
-				++bomb;
-				continue;
-			}
+			/* Don't check collision if the coal was removed or is invincible */
+			if (removedBombs[i] || bombCoals[i].IsInvincible()) { continue; }
 
 			/* bombCoal with player collision */
 			/* The bomb's circle if modified to make the radius larger... */
 			/* as it should explode when close enough to damage the player... */
 			/* with an explosion. */
-			if (DoCirclesOverlap( { bomb->GetPos(), explosionRadius }, player.GetCircle() ))
+			if (!GetContacts( ContactPair::BOMB_PLAYER ).Of( i ).Empty())
 			{
-				AddExplosion( bomb->GetPos() );
-				bomb = bombCoals.erase( bomb );
+				AddExplosion( bombCoals[i].GetPos() );
+				removedBombs[i] = true;
 
 				/* continue because the current coal should not */
 				/* undergo any more collisions */
@@ -1231,50 +1288,31 @@ namespace Tmpl8
 			}
 
 			/* bombCoal with flame collision */
-			for (auto flame = flames.begin(); flame != flames.end();)
+			const size_t flame = FindFirstContact( GetContacts( ContactPair::BOMB_FLAME ).Of( i ), [&]( size_t j ) { return !removedFlames[j]; } );
+			if (flame != SpatialGrid::NONE)
 			{
-				/* Check for overlap */
-				if (DoCirclesOverlap(bomb->GetCircle(), flame->GetCircle()))
-				{
-					AddExplosion( bomb->GetPos() );
-					flame = flames.erase( flame );
-					bomb = bombCoals.erase( bomb );
-					erased = true;
-
-					/* Grant points for shooting the coal */
-					score += points;
-					timeSinceKill = 0;
+				AddExplosion( bombCoals[i].GetPos() );
+				removedFlames[flame] = true;
+				removedBombs[i] = true;
 
-					/* Break because the coal doesn't exist anymore */
-					break;
-				}
-				else
-				{
-					++flame;
-				}
+				/* Grant points for shooting the coal */
+				score += points;
+				timeSinceKill = 0;
 			}
-			if (!erased) { ++bomb; }
 		}
 
 		/*=====================*\
 		|| BasicCoal collision ||
 		\*=====================*/
-		for (auto basic = basicCoals.begin(); basic < basicCoals.end();)
+		for (size_t i = 0; i < basicCoals.Size(); ++i)
 		{
-			/* Keeps track off if the current basicCoal was erased */
-			bool erased = false;
-
-			/* Don't check collision if the coal is invincible */
-			if (basic->IsInvincible())
-			{
-				++basic;
-				continue;
-			}
+			/* Don't check collision if the coal was removed or is invincible */
+			if (removedBasics[i] || basicCoals[i].IsInvincible()) { continue; }
 
 			/* basicCoal with player collision */
-			if (DoCirclesOverlap(basic->GetCircle(), player.GetCircle()))
+			if (!GetContacts( ContactPair::BASIC_PLAYER ).Of( i ).Empty())
 			{
-				basic->SetDead();
+				basicCoals[i].SetDead();
 
 				if (playerImmunityTimer <= 0)
 				{
@@ -1282,133 +1320,312 @@ namespace Tmpl8
 					playerImmunityTimer = maxImmunityTime;
 
 					/* Play a sound effect */
-					sfx.hurt.replay();
+					sfx.Play( SFX::Effect::HURT );
 				}
 				else
 				{
 					/* Play a sound effect */
-					sfx.contact.replay();
+					sfx.Play( SFX::Effect::CONTACT );
 				}
 			}
 
 			/* basicCoal with flame collision */
-			for (auto flame = flames.begin(); flame != flames.end();)
+			/* Also applies to a coal that just died by touching the player */
+			const size_t flame = FindFirstContact( GetContacts( ContactPair::BASIC_FLAME ).Of( i ), [&]( size_t j ) { return !removedFlames[j]; } );
+			if (flame != SpatialGrid::NONE)
 			{
-				/* Check for overlap */
-				if (DoCirclesOverlap(basic->GetCircle(), flame->GetCircle()))
-				{
-					AddFireball( basic->GetPos(), flame->GetDir() );
-					flame = flames.erase( flame );
-					basic = basicCoals.erase( basic );
-					erased = true;
+				AddFireball( basicCoals[i].GetPos(), flames[flame].GetDir() );
+				removedFlames[flame] = true;
+				removedBasics[i] = true;
 
-					/* Grant points for shooting the coal */
-					score += points * 2;
-					timeSinceKill = 0.0f;
+				/* Grant points for shooting the coal */
+				score += points * 2;
+				timeSinceKill = 0.0f;
 
-					/* Play a sound effect */
-					sfx.hitCoal.replay();
-
-					/* Break because the coal doesn't exist anymore */
-					break;
-				}
-				else
-				{
-					++flame;
-				}
+				/* Play a sound effect */
+				sfx.Play( SFX::Effect::HIT_COAL );
 			}
-			if (!erased) { ++basic; }
 		}
 
 		/*=================*\
 		|| Flame collision ||
 		\*=================*/
-		for (auto flame = flames.begin(); flame < flames.end(); )
+		/* Flame with goldCoal collision */
+		if (goldCoal.IsActive())
 		{
-			/* Flame with goldCoal collision */
-			if (goldCoal.IsActive() &&
-				DoCirclesOverlap(flame->GetCircle(), goldCoal.GetCircle()))
-			{
-				flame = flames.erase( flame );
-			}
-			else
-			{
-				++flame;
-			}
+			for (const Contact& contact : GetContacts( ContactPair::GOLD_FLAME ).Of( 0 )) { removedFlames[contact.b] = true; }
 		}
 
 		/*=====================*\
 		|| Explosion collision ||
 		\*=====================*/
-		for (auto exp = explosions.begin(); exp < explosions.end(); ++exp)
+		/* Also goes over the explosions added above */
+		explosionCircles.Clear();
+		for (const auto& explosion : explosions) { explosionCircles.Add( explosion.GetCircle() ); }
+		DetectContacts( {	ContactPair::EXPLOSION_FLAME, ContactPair::EXPLOSION_BOMB, ContactPair::EXPLOSION_BASIC,
+							ContactPair::EXPLOSION_GOLD, ContactPair::EXPLOSION_PLAYER } );
+
+		for (size_t i = 0; i < explosions.Size(); ++i)
 		{
 			/* Explosion with flame collision */
-			for (auto flame = flames.begin(); flame < flames.end();)
-			{
-				/* Check for overlap */
-				if (DoCirclesOverlap( exp->GetCircle(), flame->GetCircle() ))
-				{
-					flame = flames.erase( flame );
-				}
-				else
-				{
-					++flame;
-				}
-			}
+			for (const Contact& contact : GetContacts( ContactPair::EXPLOSION_FLAME ).Of( i )) { removedFlames[contact.b] = true; }
 			/* Explosion with bombCoal collision */
-			for (auto bomb = bombCoals.begin(); bomb < bombCoals.end();)
+			for (const Contact& contact : GetContacts( ContactPair::EXPLOSION_BOMB ).Of( i ))
 			{
-				/* Check for overlap */
-				if (!bomb->IsInvincible() && DoCirclesOverlap( exp->GetCircle(), bomb->GetCircle() ))
-				{
-					bomb = bombCoals.erase( bomb );
-				}
-				else
-				{
-					++bomb;
-				}
+				if (!bombCoals[contact.b].IsInvincible()) { removedBombs[contact.b] = true; }
 			}
 			/* Explosion with basicCoal collision */
-			for (auto basic = basicCoals.begin(); basic < basicCoals.end();)
+			for (const Contact& contact : GetContacts( ContactPair::EXPLOSION_BASIC ).Of( i ))
 			{
-				/* Check for overlap */
-				if (!basic->IsInvincible() && DoCirclesOverlap( exp->GetCircle(), basic->GetCircle() ))
-				{
-					basic = basicCoals.erase( basic );
-				}
-				else
-				{
-					++basic;
-				}
+				if (!basicCoals[contact.b].IsInvincible()) { removedBasics[contact.b] = true; }
 			}
 			/* Explosion with goldCoal collision */
-			if (goldCoal.IsActive() &&
-				DoCirclesOverlap( exp->GetCircle(), goldCoal.GetCircle() ))
+			if (goldCoal.IsActive() && !GetContacts( ContactPair::EXPLOSION_GOLD ).Of( i ).Empty())
 			{
 				goldCoal.SetActive( false );
 			}
 			/* Explosion with player collision */
-			if (playerImmunityTimer <= 0 &&
-				DoCirclesOverlap( exp->GetCircle(), player.GetCircle() ))
+			if (playerImmunityTimer <= 0 && !GetContacts( ContactPair::EXPLOSION_PLAYER ).Of( i ).Empty())
 			{
 				playerImmunityTimer = maxImmunityTime;
 				player.reduceHitPoints( playerDamage );
 
 				/* Play a sound effect */
-				sfx.hurt.replay();
+				sfx.Play( SFX::Effect::HURT );
 
 				/* break to avoid redundant collision checks */
 				break;
 			}
 		}
+
+		flames.RemoveFlagged( removedFlames );
+		bombCoals.RemoveFlagged( removedBombs );
+		basicCoals.RemoveFlagged( removedBasics );
 		
 		player.SetImmunity( playerImmunityTimer );
 	}
 
+	void Game::DetectContacts( std::initializer_list<ContactPair> pairs )
+	{
+		/* Every pair only writes to its own list, so they can be detected at the same time */
+		/* Without workers every pair is detected here */
+		const bool useJobs = jobSystem.GetWorkerCount() > 0;
+		std::array<JobHandle, static_cast<size_t>(ContactPair::COUNT)> jobs;
+		size_t jobCount = 0;
+		bool keptLarge = false;
+		for (const ContactPair pair : pairs)
+		{
+			if (!useJobs || ContactGridQueries( pair ) < minContactJobQueries) { continue; }
+
+			/* The first large pair is kept for this thread, so a single one never waits on a job */
+			if (!keptLarge) { keptLarge = true; continue; }
+			jobs[jobCount++] = jobSystem.Submit( [this, pair]() { DetectContacts( pair ); }, "contacts" );
+		}
+
+		/* The small pairs and the kept large one, while the jobs run */
+		keptLarge = false;
+		for (const ContactPair pair : pairs)
+		{
+			if (useJobs && ContactGridQueries( pair ) >= minContactJobQueries)
+			{
+				if (keptLarge) { continue; }
+				keptLarge = true;
+			}
+			DetectContacts( pair );
+		}
+		for (size_t i = 0; i < jobCount; ++i) { jobSystem.Wait( jobs[i] ); }
+	}
+
+	size_t Game::ContactGridQueries( ContactPair pair ) const
+	{
+		switch (pair)
+		{
+		case ContactPair::FIREBALL_FIREBALL:
+		case ContactPair::FIREBALL_FLAME:
+		case ContactPair::FIREBALL_BOMB:
+		case ContactPair::FIREBALL_BASIC:
+			return fireballs.Size();
+		case ContactPair::BOMB_FLAME:
+			return bombCoals.Size();
+		case ContactPair::BASIC_FLAME:
+			return basicCoals.Size();
+		case ContactPair::GOLD_FLAME:
+			return 1;
+		case ContactPair::EXPLOSION_FLAME:
+		case ContactPair::EXPLOSION_BOMB:
+		case ContactPair::EXPLOSION_BASIC:
+			return explosions.Size();
+		case ContactPair::FIREBALL_PLAYER:
+		case ContactPair::FIREBALL_GOLD:
+		case ContactPair::BOMB_PLAYER:
+		case ContactPair::BASIC_PLAYER:
+		case ContactPair::EXPLOSION_GOLD:
+		case ContactPair::EXPLOSION_PLAYER:
+		case ContactPair::COUNT:
+			break;
+		}
+
+		return 0;
+	}
+
+	void Game::DetectContacts( ContactPair pair )
+	{
+		ContactList& list = contacts[static_cast<size_t>(pair)];
+
+		auto fireball = [this]( size_t i ) { return fireballs[i].GetCircle(); };
+		auto flame = [this]( size_t i ) { return flames[i].GetCircle(); };
+		auto bomb = [this]( size_t i ) { return bombCoals[i].GetCircle(); };
+		auto basic = [this]( size_t i ) { return basicCoals[i].GetCircle(); };
+		auto explosion = [this]( size_t i ) { return explosions[i].GetCircle(); };
+		auto gold = [this]( size_t ) { return goldCoal.GetCircle(); };
+
+		switch (pair)
+		{
+		case ContactPair::FIREBALL_FIREBALL:
+			list.Begin( pair, fireballs.Size() );
+			DetectInGrid( list, fireballs.Size(), fireballGrid, fireball, fireball, true );
+			break;
+		case ContactPair::FIREBALL_FLAME:
+			list.Begin( pair, fireballs.Size() );
+			DetectInGrid( list, fireballs.Size(), flameGrid, fireball, flame );
+			break;
+		case ContactPair::FIREBALL_PLAYER:
+			list.Begin( pair, fireballs.Size() );
+			DetectWithSingle( list, fireballCircles, player.GetCircle() );
+			break;
+		case ContactPair::FIREBALL_BOMB:
+			list.Begin( pair, fireballs.Size() );
+			DetectInGrid( list, fireballs.Size(), bombGrid, fireball, bomb );
+			break;
+		case ContactPair::FIREBALL_BASIC:
+			list.Begin( pair, fireballs.Size() );
+			DetectInGrid( list, fireballs.Size(), basicGrid, fireball, basic );
+			break;
+		case ContactPair::FIREBALL_GOLD:
+			list.Begin( pair, fireballs.Size() );
+			DetectWithSingle( list, fireballCircles, goldCoal.GetCircle() );
+			break;
+		case ContactPair::BOMB_PLAYER:
+			/* The bomb's circle is as large as its explosion, see DoCollision() */
+			list.Begin( pair, bombCoals.Size() );
+			/* so the bombs' positions are tested against the player's circle grown by that radius */
+			if (const Circle playerCircle = player.GetCircle(); playerCircle.r > 0.0f && explosionRadius > 0.0f)
+			{
+				ForEachInRange( playerCircle.pos, explosionRadius + playerCircle.r, bombCircles,
+					[&]( size_t a ) { list.Add( a, 0 ); } );
+			}
+			break;
+		case ContactPair::BOMB_FLAME:
+			list.Begin( pair, bombCoals.Size() );
+			DetectInGrid( list, bombCoals.Size(), flameGrid, bomb, flame );
+			break;
+		case ContactPair::BASIC_PLAYER:
+			list.Begin( pair, basicCoals.Size() );
+			DetectWithSingle( list, basicCircles, player.GetCircle() );
+			break;
+		case ContactPair::BASIC_FLAME:
+			list.Begin( pair, basicCoals.Size() );
+			DetectInGrid( list, basicCoals.Size(), flameGrid, basic, flame );
+			break;
+		case ContactPair::GOLD_FLAME:
+			list.Begin( pair, 1 );
+			DetectInGrid( list, 1, flameGrid, gold, flame );
+			break;
+		case ContactPair::EXPLOSION_FLAME:
+			list.Begin( pair, explosions.Size() );
+			DetectInGrid( list, explosions.Size(), flameGrid, explosion, flame );
+			break;
+		case ContactPair::EXPLOSION_BOMB:
+			list.Begin( pair, explosions.Size() );
+			DetectInGrid( list, explosions.Size(), bombGrid, explosion, bomb );
+			break;
+		case ContactPair::EXPLOSION_BASIC:
+			list.Begin( pair, explosions.Size() );
+			DetectInGrid( list, explosions.Size(), basicGrid, explosion, basic );
+			break;
+		case ContactPair::EXPLOSION_GOLD:
+			list.Begin( pair, explosions.Size() );
+			DetectWithSingle( list, explosionCircles, goldCoal.GetCircle() );
+			break;
+		case ContactPair::EXPLOSION_PLAYER:
+			list.Begin( pair, explosions.Size() );
+			DetectWithSingle( list, explosionCircles, player.GetCircle() );
+			break;
+		case ContactPair::COUNT:
+			break;
+		}
+
+		list.End();
+	}
+
+	void Game::BuildCollisionGrids()
+	{
+		flameGrid.Clear();
+		for (const auto& flame : flames) { flameGrid.Insert( flame.GetCircle() ); }
+		flameGrid.Build();
+		removedFlames.assign( flames.Size(), false );
+
+		bombGrid.Clear();
+		bombCircles.Clear();
+		for (const auto& bomb : bombCoals)
+		{
+			bombGrid.Insert( bomb.GetCircle() );
+			bombCircles.Add( bomb.GetPos() );
+		}
+		bombGrid.Build();
+		removedBombs.assign( bombCoals.Size(), false );
+
+		basicGrid.Clear();
+		basicCircles.Clear();
+		for (const auto& basic : basicCoals)
+		{
+			basicGrid.Insert( basic.GetCircle() );
+			basicCircles.Add( basic.GetCircle() );
+		}
+		basicGrid.Build();
+		removedBasics.assign( basicCoals.Size(), false );
+
+		fireballGrid.Clear();
+		fireballCircles.Clear();
+		for (const auto& fBall : fireballs)
+		{
+			fireballGrid.Insert( fBall.GetCircle() );
+			fireballCircles.Add( fBall.GetCircle() );
+		}
+		fireballGrid.Build();
+		removedFireballs.assign( fireballs.Size(), false );
+	}
+
+	void Game::UpdateSpawnGrids()
+	{
+		coalSpawnGrid.BeginUpdate();
+		for (size_t i = 0; i < basicCoals.Size(); ++i)
+		{
+			coalSpawnGrid.Set( basicCoals.GetHandle( i ).slot, basicCoals[i].GetPos(), coalSpawnDist );
+		}
+		for (size_t i = 0; i < bombCoals.Size(); ++i)
+		{
+			coalSpawnGrid.Set( maxCoals + bombCoals.GetHandle( i ).slot, bombCoals[i].GetPos(), coalSpawnDist );
+		}
+		coalSpawnGrid.Set( maxCoals * 2, player.GetPos(), coalSpawnDist );
+		coalSpawnGrid.EndUpdate();
+
+		goldSpawnGrid.BeginUpdate();
+		for (size_t i = 0; i < explosions.Size(); ++i)
+		{
+			goldSpawnGrid.Set( explosions.GetHandle( i ).slot, explosions[i].GetPos(), goldSpawnDistDanger );
+		}
+		for (size_t i = 0; i < fireballs.Size(); ++i)
+		{
+			goldSpawnGrid.Set( maxExplosions + fireballs.GetHandle( i ).slot, fireballs[i].GetPos(), goldSpawnDistDanger );
+		}
+		goldSpawnGrid.EndUpdate();
+	}
+
 	void Game::DrawScreen()
 	{
 		/* Draw everything to the screen */
-		background_sprite->Draw( screen, 0, 0 );
+		background_sprite->Draw( screen, 0, 0, 0 );
 
 		/* Draw the drop shadows of the coals and player */
 		for (auto& coal : basicCoals)	{ coal.DrawShadow( screen ); }
@@ -1416,7 +1633,7 @@ namespace Tmpl8
 		if (goldCoal.IsActive())		{ goldCoal.DrawShadow( screen ); }
 		player.DrawShadow( screen );
 
-		foreground_sprite->Draw( screen, 0, 0 );
+		foreground_sprite->Draw( screen, 0, 0, 0 );
 
 		bool drawnHearts = false;
 		/* After the first attempt, have the hearts appear one by one */
@@ -1428,7 +1645,7 @@ namespace Tmpl8
 			}
 			else if (gameTimer < 0.4f)
 			{
-				heart_sprite->Draw( screen, 64, 3 );
+				heart_sprite->Draw( screen, 64, 3, 0 );
 
 				/* When the second heart is drawn, the player has at least two hit points */
 				if (oneHitPointLeft && gameTimer >= 2.0f) { oneHitPointLeft = false; }
@@ -1437,8 +1654,8 @@ namespace Tmpl8
 			}
 			else if (gameTimer < 0.6f)
 			{
-				heart_sprite->Draw( screen, 64, 3 );
-				heart_sprite->Draw( screen, 128, 3 );
+				heart_sprite->Draw( screen, 64, 3, 0 );
+				heart_sprite->Draw( screen, 128, 3, 0 );
 
 				drawnHearts = true;
 			}
@@ -1450,7 +1667,7 @@ namespace Tmpl8
 			{
 				if (i <= player.GetHitPoints())
 				{
-					heart_sprite->Draw( screen, (64 * i), 3 );
+					heart_sprite->Draw( screen, (64 * i), 3, 0 );
 				}
 			}
 		}
@@ -1492,36 +1709,40 @@ namespace Tmpl8
 		}
 	}
 
-	void Game::DarkenScreen() const
+	void Game::DarkenScreen()
 	{
 		Pixel* address = screen->GetBuffer();
 
-		/* Go over all pixels (colors) on the screen */
-		for (int y = 0; y < ScreenHeight; ++y)
+		/* Go over all pixels (colors) on the screen, bands of rows are darkened in parallel */
+		constexpr size_t rowsPerJob{ 64 };
+		jobSystem.ParallelFor( 0, ScreenHeight, rowsPerJob, [address]( size_t firstRow, size_t lastRow )
 		{
-			for (int x = 0; x < ScreenWidth; ++x)
+			for (int y = static_cast<int>(firstRow); y < static_cast<int>(lastRow); ++y)
 			{
-				/* Get the current pixel's color */
-				const int color = static_cast<int>(address[x + y * ScreenWidth]);
-				/* Divide the color into red, green and blue */
-				int r = color & RedMask;
-				int g = color & GreenMask;
-				int b = color & BlueMask;
+				for (int x = 0; x < ScreenWidth; ++x)
+				{
+					/* Get the current pixel's color */
+					const int color = static_cast<int>(address[x + y * ScreenWidth]);
+					/* Divide the color into red, green and blue */
+					int r = color & RedMask;
+					int g = color & GreenMask;
+					int b = color & BlueMask;
 
-				r >>= 16;
-				g >>= 8;
+					r >>= 16;
+					g >>= 8;
 
-				/* Darken the color */
-				r /= 2;
-				g /= 2;
-				b /= 2;
+					/* Darken the color */
+					r /= 2;
+					g /= 2;
+					b /= 2;
 
-				const Pixel newColor = (r << 16) + (g << 8) + b;
+					const Pixel newColor = (r << 16) + (g << 8) + b;
 
-				//const Pixel newColor = AddBlend( color, 0xa5a5a5 );
-				address[x + y * ScreenWidth] = newColor;
+					//const Pixel newColor = AddBlend( color, 0xa5a5a5 );
+					address[x + y * ScreenWidth] = newColor;
+				}
 			}
-		}
+		}, "darken screen" );
 	}
 
 	void Game::DrawEntityHitBox() const
@@ -1535,6 +1756,26 @@ namespace Tmpl8
 		player.DrawHitBox( screen );
 	}
 
+	void Game::DrawJobTimes( float deltaTime )
+	{
+		jobTimesWindow += deltaTime;
+		jobTimesTicks++;
+		if (jobTimesWindow >= 1.0f)
+		{
+			for (size_t i = 0; i < jobBusyTime.size(); ++i) { jobBusyPerTick[i] = jobBusyTime[i].exchange( 0 ) / (jobTimesTicks * 1000ll); }
+			jobTimesWindow = 0.0f;
+			jobTimesTicks = 0;
+		}
+
+		for (size_t i = 0; i < jobBusyPerTick.size(); ++i)
+		{
+			const bool waiting = (i + 1 == jobBusyPerTick.size());
+			const std::string line = (waiting ? std::string( "waiting" ) : "worker " + std::to_string( i )) +
+				": " + std::to_string( jobBusyPerTick[i] ) + " us";
+			screen->Print( line.c_str(), 10, 70 + static_cast<int>(i) * 14, 0x00ff00, 2 );
+		}
+	}
+
 	void Game::KillEnemies()
 	{
 		/* Add an explosion on every entity */
@@ -1568,7 +1809,7 @@ namespace Tmpl8
 		for (auto& e : fireballs)	{ AddExplosion( e.GetPos() ); }
 		if (goldCoal.IsActive())	{ AddExplosion( goldCoal.GetPos() ); }
 
-		fireballs.clear();
+		fireballs.Clear();
 		goldCoal.SetActive( false );
 
 		killedEnemies = true;
@@ -1576,9 +1817,9 @@ namespace Tmpl8
 
 	inline bool Game::AllEnemiesDead() const
 	{
-		return (basicCoals.empty() &&
-				bombCoals.empty() &&
-				fireballs.empty() &&
+		return (basicCoals.Empty() &&
+				bombCoals.Empty() &&
+				fireballs.Empty() &&
 				!goldCoal.IsActive());
 	}
 
@@ -1612,6 +1853,23 @@ namespace Tmpl8
 		return false;
 	}
 
+	Sequence Game::GameOverSequence()
+	{
+		co_await Seconds( 1.5f );
+		KillEnemies();
+
+		co_await Seconds( 1.0f );
+		co_await Until( [this] { return MovePlayerTowardsCenter(); } );
+
+		/* Only change the game mode once the player has reached the center */
+		gameState = GameState::GAME_OVER_MENU;
+
+		killedEnemies = false;
+		/* Update the high score when necessary*/
+		if (regularGameOver) { UpdateHighScore(); }
+		if (newHighScore) { scoreFlashTimer = maxScoreFlashTime; }
+	}
+
 	void Game::ResetGameVariables()
 	{
 		score = 0;
@@ -1619,7 +1877,7 @@ namespace Tmpl8
 		newHighScore = false;
 		scoreFlashTimer = 0.0f;
 		gameTimer = 0;
-		timeSinceGameOver = 0;
+		sequences.Clear();
 		killedEnemies = false;
 		konamiKeyCount = 0;
 		previousLeftPressed = false;
@@ -1641,6 +1899,8 @@ namespace Tmpl8
 
 		player.SetImmunity( 0.0f );
 		player.SetHitPoints( 3 );
+		/* The secret mode activates it again, a regular game lets the sprite cache unload the mushroom man */
+		player.DeactivateMushroomMan();
 	}
 
 	/* The game crashes if highScore.txt holds non-numbers */
@@ -1745,6 +2005,57 @@ namespace Tmpl8
 		AddCoalBasic( { 710.0f, 606.125 } );
 	}
 
+	void Game::WaitForGameAssets()
+	{
+		if (gameAssetsBound) { return; }
+
+		assets.Wait( AssetGroup::GAME );
+		BindGameAssets();
+	}
+
+	void Game::BindMenuAssets()
+	{
+		SpriteRegistry::Set( explosionSpriteId, explosion_sprite );
+	}
+
+	void Game::BindGameAssets()
+	{
+		SpriteRegistry::Set( playerSpriteId, player_sprite );
+		SpriteRegistry::Set( flameSpriteId, flame_sprite );
+		SpriteRegistry::Set( coalBasicSpriteId, coalBasic_sprite );
+		SpriteRegistry::Set( coalBombSpriteId, coalBomb_sprite );
+		SpriteRegistry::Set( coalGoldSpriteId, coalGold_sprite );
+		SpriteRegistry::Set( fireballSpriteId, fireball_sprite );
+
+		player.SetSprite( playerSpriteId );
+		goldCoal.SetSprite( coalGoldSpriteId );
+		gameAssetsBound = true;
+	}
+
+	void Game::OnGameStateChanged()
+	{
+		switch (gameState)
+		{
+		case GameState::MENU:
+		case GameState::GAME_OVER_MENU: // the main menu is one click away
+			spriteCache.Prefetch( menuScreenSprite );
+			sfx.SetMusic( SFX::Track::MENU );
+			break;
+		case GameState::INFO:
+			spriteCache.Prefetch( infoSprite );
+			sfx.SetMusic( SFX::Track::MENU );
+			break;
+		case GameState::GAME:
+		case GameState::SECRET_MODE:
+			/* None of the full screen images are drawn during game play */
+			spriteCache.EvictIdle();
+			sfx.SetMusic( SFX::Track::GAME );
+			break;
+		default:
+			break;
+		}
+	}
+
 	void Game::MouseUp( Uint8 key)
 	{
 		if (key == SDL_BUTTON_LEFT) { mouseDown = false; }
@@ -1771,6 +2082,16 @@ namespace Tmpl8
 		if (key == SDL_SCANCODE_SPACE) { boost = false; }
 
 		if (key == SDL_SCANCODE_F5) { drawHitBox = !drawHitBox; }
+		if (key == SDL_SCANCODE_F6)
+		{
+			drawJobTimes = !drawJobTimes;
+
+			/* Start a new second, the hook has been adding up the whole time */
+			for (auto& busyTime : jobBusyTime) { busyTime = 0; }
+			jobBusyPerTick.assign( jobBusyTime.size(), 0 );
+			jobTimesWindow = 0.0f;
+			jobTimesTicks = 0;
+		}
 
 		/* Checks for inputs matching the Konami code */
 		if ((gameState == GameState::GAME_OVER_MENU ||
@@ -1794,6 +2115,8 @@ namespace Tmpl8
 			{
 				secretMode = true;
 				konamiKeyCount = 0;
+				/* Start loading the mushroom man, it's needed on the next tick */
+				spriteCache.Prefetch( mushroomSprite );
 			}
 		}
 	}
@@ -1818,7 +2141,7 @@ namespace Tmpl8
 				quitButton.SetPos( 274, 458 );
 
 				/* Play the button sound effect */
-				sfx.button.replay();
+				sfx.Play( SFX::Effect::BUTTON );
 			}
 			else if (gameState == GameState::PAUSE)
 			{
@@ -1836,7 +2159,7 @@ namespace Tmpl8
 				menuButton.SetPos( 100, 360 );
 
 				/* Play the button sound effect */
-				sfx.button.replay();
+				sfx.Play( SFX::Effect::BUTTON );
 			}
 			else if (gameState == GameState::SECRET_MODE)
 			{
@@ -1847,7 +2170,7 @@ namespace Tmpl8
 				quitButton.SetPos( 274, 458 );
 
 				/* Play the button sound effect */
-				sfx.button.replay();
+				sfx.Play( SFX::Effect::BUTTON );
 			}
 		}
 	}
@@ -1864,24 +2187,40 @@ namespace Tmpl8
 
 	inline void Game::AddFlame(vec2 _pos)
 	{
-		flames.emplace_back( flame_sprite, _pos, flameRadius, globalSpeed );
-		sfx.shoot.replay();
+		if (flames.Emplace( flameSpriteId, _pos, flameRadius, globalSpeed ).IsValid()) { sfx.Play( SFX::Effect::SHOOT ); }
 	}
 	inline void Game::AddCoalBasic(vec2 _pos)
 	{
-		basicCoals.emplace_back( coalBasic_sprite, _pos, coalRadius, globalSpeed );
+		const PoolHandle handle = basicCoals.Emplace( coalBasicSpriteId, _pos, coalRadius, globalSpeed );
+		if (!handle.IsValid()) { return; }
+
+		basicCoalMotion.Grow( handle.slot + 1 );
+		basicCoals.Get( handle )->BindMotion( &basicCoalMotion, handle.slot );
+		basicCoalTimers.Schedule( CoalBasic::timeBetweenFrameUpdates, handle );
 	}
 	inline void Game::AddCoalBomb(vec2 _pos)
 	{
-		bombCoals.emplace_back( coalBomb_sprite, _pos, coalRadius, globalSpeed );
+		const PoolHandle handle = bombCoals.Emplace( coalBombSpriteId, _pos, coalRadius, globalSpeed );
+		if (!handle.IsValid()) { return; }
+
+		bombCoalMotion.Grow( handle.slot + 1 );
+		bombCoals.Get( handle )->BindMotion( &bombCoalMotion, handle.slot );
+		bombCoalTimers.Schedule( CoalBomb::timeBetweenFrameUpdates, handle );
 	}
 	inline void Game::AddExplosion(vec2 _pos)
 	{
-		explosions.emplace_back( explosion_sprite, _pos, explosionRadius, globalSpeed );
-		sfx.explosion.replay();
+		const PoolHandle handle = explosions.Emplace( explosionSpriteId, _pos, explosionRadius, globalSpeed );
+		if (!handle.IsValid()) { return; }
+
+		explosionTimers.Schedule( Explosion::timeBetweenFrames, handle );
+		sfx.Play( SFX::Effect::EXPLOSION );
 	}
 	inline void Game::AddFireball(vec2 _pos, vec2 _dir)
 	{
-		fireballs.emplace_back( fireball_sprite, _pos, _dir, fireballRadius, globalSpeed );
+		const PoolHandle handle = fireballs.Emplace( fireballSpriteId, _pos, _dir, fireballRadius, globalSpeed );
+		if (!handle.IsValid()) { return; }
+
+		fireballMotion.Grow( handle.slot + 1 );
+		fireballs.Get( handle )->BindMotion( &fireballMotion, handle.slot );
 	}
 };
\ No newline at end of file
@@ -9,7 +9,23 @@
 #include "button.h"
 #include "player.h"
 #include "sfx.h"
-
+#include "jobSystem.h"
+#include "assetManager.h"
+#include "spriteCache.h"
+#include "spatialGrid.h"
+#include "chaseTarget.h"
+#include "aiScheduler.h"
+#include "motionBatch.h"
+#include "pool.h"
+#include "contactList.h"
+#include "circleBatch.h"
+#include "occupancyGrid.h"
+#include "timingWheel.h"
+#include "sequence.h"
+#include "systemScheduler.h"
+
+#include <array>
+#include <initializer_list>
 #include <memory>
 #include <vector>
 #include <SDL_scancode.h>
@@ -25,6 +41,7 @@ namespace Tmpl8 {
 
 	enum class GameState
 	{
+		LOADING, // shown on startup until the main menu's assets are loaded
 		MENU, // main menu
 		INFO, // info menu
 		GAME, // main game play loop
@@ -52,21 +69,58 @@ namespace Tmpl8 {
 		/* and calls to create it */
 		void UpdateAndManageCoalSpawning( float deltaTime );
 		void UpdateObjects( float deltaTime );
+		/* Adds the systems UpdateObjects() runs, with the resources each of them reads and writes */
+		void AddUpdateSystems();
+		/* Inserts the basic and bomb coals in the separation grid, before they move */
+		void BuildSeparationGrid();
+		/* Updates the fireballs, then moves and bounces all of them at once in fireballMotion */
+		void UpdateFireballs( float deltaTime );
+		/* Keeps the basic and bomb coals within the walls, call after they moved */
+		void ClampCoalsToWalls();
+		/* Steps the frames of the explosions whose timers expired */
+		void UpdateExplosions( float deltaTime );
 		void UpdateDespawnCoals( float deltaTime );
 		void UpdateDisplayScore( float deltaTime );
 		/* Checks if the "bounce" sound effect should be played */
 		void UpdateBounceSFX();
 		void DoCollision();
+		/* Inserts every collidable entity in its grid, used by DoCollision() */
+		void BuildCollisionGrids();
+		/* Moves the entities in the spawn grids to their current positions */
+		void UpdateSpawnGrids();
+		/* Fills the contact lists of the given pairs, the pairs with enough circles to test each get a job */
+		/* the others are detected on the calling thread while the jobs run */
+		/* Only reads the entities, DoCollision() applies the contacts afterwards */
+		void DetectContacts( std::initializer_list<ContactPair> pairs );
+		void DetectContacts( ContactPair pair );
+		/* The amount of circles looked up in a grid for the pair, 0 for the pairs tested against a single circle */
+		/* Those only go over a CircleBatch, which is cheap at any size */
+		[[nodiscard]] size_t ContactGridQueries( ContactPair pair ) const;
+		[[nodiscard]] const ContactList& GetContacts( ContactPair pair ) const { return contacts[static_cast<size_t>(pair)]; }
 		void DrawScreen();
-		void DarkenScreen() const;
+		void DarkenScreen();
 		void DrawEntityHitBox() const;
+		/* Prints how long every worker was busy per tick, averaged over the last second */
+		void DrawJobTimes( float deltaTime );
 		void KillEnemies();
 		[[nodiscard]] inline bool AllEnemiesDead() const;
 		/* returns true if the player reached the center */
 		bool MovePlayerTowardsCenter();
+		/* Kills the enemies, moves the player to the center and opens the game over menu */
+		/* Started when the game is over, runs in GameState::GAME_OVER */
+		Sequence GameOverSequence();
 		void ResetGameVariables();
 		void UpdateHighScore();
 		void SetUpSecretMode();
+		/* Blocks until the game play assets are loaded, used before leaving the main menu */
+		void WaitForGameAssets();
+		/* Puts the loaded menu sprites in the sprite registry */
+		void BindMenuAssets();
+		/* Puts the loaded game play sprites in the sprite registry, */
+		/* and hands them to the entities that were created without them */
+		void BindGameAssets();
+		/* Prefetches the sprites the new game state needs, evicts those it doesn't and switches the music */
+		void OnGameStateChanged();
 		void MouseUp( Uint8 key );
 		void MouseDown( Uint8 key );
 		void MouseMove( int x, int y );
@@ -85,17 +139,49 @@ namespace Tmpl8 {
 		[[nodiscard]] int GetMouseX() const { return mousex; }
 		[[nodiscard]] int GetMouseY() const { return mousey; }
 		[[nodiscard]] bool IsMouseDown() const { return mouseDown; }
-		[[nodiscard]] const vector<CoalBasic>& GetCoalBasicVec() const { return basicCoals; }
-		[[nodiscard]] const vector<CoalBomb>& GetCoalBombVec() const { return bombCoals; }
+		[[nodiscard]] const Pool<CoalBasic>& GetCoalBasicPool() const { return basicCoals; }
+		[[nodiscard]] const Pool<CoalBomb>& GetCoalBombPool() const { return bombCoals; }
 		[[nodiscard]] const CoalGold& GetGoldCoal() const { return goldCoal; }
+		/* Only valid during UpdateObjects(), see Coal::ApplySeparation() */
+		[[nodiscard]] const SpatialGrid& GetSeparationGrid() const { return separationGrid; }
+		[[nodiscard]] WallBounds GetWalls() const { return walls; }
+		[[nodiscard]] const ChaseTarget& GetChaseTarget() const { return chaseTarget; }
+		[[nodiscard]] const AiScheduler& GetAiScheduler() const { return aiScheduler; }
 		[[nodiscard]] vec2 GetPlayerPos() const { return player.GetPos(); }
 
 	private:
 
 		Surface* screen;
-		GameState gameState{ GameState::MENU };
+		GameState gameState{ GameState::LOADING };
+		GameState previousGameState{ GameState::LOADING };
 		SFX sfx;
 
+		/* Shared by the asset decoding, the entity updates, the collision detection and drawing */
+		/* Its workers are started in Init() */
+		JobSystem jobSystem;
+		/* Decodes the sprites and sounds in the background */
+		AssetManager assets{ jobSystem };
+		/* Runs the entity updates of a tick, see AddUpdateSystems() */
+		SystemScheduler updateSystems{ jobSystem };
+		/* True once the game play sprites are handed to the player and gold coal */
+		bool gameAssetsBound{ false };
+		/* Full screen images and the mushroom man are only resident while they're used */
+		/* Large enough to hold one full screen image and the mushroom man, but not two screens */
+		const size_t spriteCacheBudget{ 4 * 1024 * 1024 };
+		SpriteCache spriteCache{ assets, spriteCacheBudget };
+		SpriteHandle menuScreenSprite{ 0 };
+		SpriteHandle infoSprite{ 0 };
+		SpriteHandle mushroomSprite{ 0 };
+
+		/* What the entities are drawn with, filled once the sprites are loaded */
+		SpriteId playerSpriteId{ SpriteRegistry::NONE };
+		SpriteId flameSpriteId{ SpriteRegistry::NONE };
+		SpriteId coalBasicSpriteId{ SpriteRegistry::NONE };
+		SpriteId coalBombSpriteId{ SpriteRegistry::NONE };
+		SpriteId coalGoldSpriteId{ SpriteRegistry::NONE };
+		SpriteId explosionSpriteId{ SpriteRegistry::NONE };
+		SpriteId fireballSpriteId{ SpriteRegistry::NONE };
+
 		/* Mersenne Twister random number generator */
 		std::mt19937_64 rng;
 		/* Numbers based on the screen borders and coal width / height */
@@ -117,7 +203,6 @@ namespace Tmpl8 {
 		/* Points granted per enemy (might be multiplied for certain enemies) */
 		const int points{ 5 };
 		float gameTimer{ 0.0f };
-		float timeSinceGameOver{ 0.0f };
 		/* Timer for the explosion on the menu screen */
 		float menuExplosionTimer{ 0.0f };
 		const float menuExplosionCooldown{ 0.7f };
@@ -127,6 +212,15 @@ namespace Tmpl8 {
 		const float maxFlashTime{ 1.4f };
 		bool killedEnemies{ false };
 		bool drawHitBox{ false };
+		/* Debug toggle (F6) for DrawJobTimes() */
+		bool drawJobTimes{ false };
+		/* Nanoseconds spent running jobs per worker, added to by the job system's timing hook */
+		/* The last entry is for the threads that ran jobs while waiting, like the main thread */
+		std::vector<std::atomic<long long>> jobBusyTime;
+		/* In microseconds, as printed */
+		vector<long long> jobBusyPerTick;
+		float jobTimesWindow{ 0.0f };
+		int jobTimesTicks{ 0 };
 		/* False if the game was paused via GameState::SECRET_MODE */
 		/* True if the game was paused via GameState::GAME */
 		bool pausedByGame{ false };
@@ -178,13 +272,24 @@ namespace Tmpl8 {
 		const float fireballRadius{ 36.0f };
 		const float playerRadius{ 19.0f };
 
-		/* object (vectors) */
-
-		vector<Flame> flames;
-		vector<CoalBasic> basicCoals;
-		vector<CoalBomb> bombCoals;
-		vector<Fireball> fireballs;
-		vector<Explosion> explosions;
+		/* The area within the walls */
+		const vec2 arenaMin{ 64.0f, 64.0f };
+		const vec2 arenaMax{ static_cast<float>(ScreenWidth) - 64.0f, static_cast<float>(ScreenHeight) - 64.0f };
+
+		/* object (pools) */
+		/* Allocated once, these are gameplay limits: an object is not created when its pool is full */
+		/* The spawn grids are sized from them too, so they can't change while playing */
+
+		const size_t maxFlames{ 256 };
+		const size_t maxCoals{ 512 };
+		const size_t maxFireballs{ 256 };
+		/* Game over turns every coal and fireball (and the gold coal) into an explosion at once */
+		const size_t maxExplosions{ maxCoals * 2 + maxFireballs + 1 };
+		Pool<Flame> flames{ maxFlames };
+		Pool<CoalBasic> basicCoals{ maxCoals };
+		Pool<CoalBomb> bombCoals{ maxCoals };
+		Pool<Fireball> fireballs{ maxFireballs };
+		Pool<Explosion> explosions{ maxExplosions };
 		CoalGold goldCoal;
 		Player player;
 		Button playButton;
@@ -195,6 +300,65 @@ namespace Tmpl8 {
 		Button quitButton;
 		Button infoButton;
 
+		/* Broad-phase collision, rebuilt every DoCollision() */
+		/* About the size of a fireball, the largest entity */
+		const float collisionCellSize{ 64.0f };
+		SpatialGrid flameGrid{ arenaMin, arenaMax, collisionCellSize };
+		SpatialGrid bombGrid{ arenaMin, arenaMax, collisionCellSize };
+		SpatialGrid basicGrid{ arenaMin, arenaMax, collisionCellSize };
+		SpatialGrid fireballGrid{ arenaMin, arenaMax, collisionCellSize };
+		/* Entities hit during DoCollision(), erased at the end of it */
+		vector<bool> removedFlames;
+		vector<bool> removedBombs;
+		vector<bool> removedBasics;
+		vector<bool> removedFireballs;
+		/* One list per ContactPair, filled by DetectContacts() */
+		std::array<ContactList, static_cast<size_t>(ContactPair::COUNT)> contacts;
+		/* Pairs with fewer grid queries than this take about as long as submitting and waiting on a job */
+		static constexpr size_t minContactJobQueries{ 32 };
+		/* The circles of the entities tested against a single circle, like the player's */
+		CircleBatch fireballCircles;
+		CircleBatch bombCircles;
+		CircleBatch basicCircles;
+		CircleBatch explosionCircles;
+
+		/* Where new coals can spawn, kept up to date by UpdateSpawnGrids() */
+		/* Matches the range of rand_x and rand_y */
+		const vec2 spawnMin{ 88.0f, 83.0f };
+		const vec2 spawnMax{ 712.0f, 687.0f };
+		const float spawnCellSize{ 16.0f };
+		/* Blocked by the basic coals (by slot), the bomb coals (after the basics) and the player (last) */
+		OccupancyGrid coalSpawnGrid{ spawnMin, spawnMax, spawnCellSize, maxCoals * 2 + 1 };
+		/* Blocked by the explosions (by slot) and the fireballs (after the explosions) */
+		OccupancyGrid goldSpawnGrid{ spawnMin, spawnMax, spawnCellSize, maxExplosions + maxFireballs };
+
+		/* Neighbour lookup for the coals' separation steering */
+		/* Cells match the coals' separation radius */
+		const float separationCellSize{ 50.0f };
+		SpatialGrid separationGrid{ arenaMin, arenaMax, separationCellSize };
+
+		/* Steers the coals towards the player */
+		ChaseTarget chaseTarget;
+		/* Lowers how often coals far away from the player steer */
+		AiScheduler aiScheduler;
+
+		/* The positions and directions of the fireballs and coals, a row per slot of their pools */
+		/* The entities are bound to their row when added, the wall kernels run over the batches directly */
+		MotionBatch fireballMotion;
+		MotionBatch basicCoalMotion;
+		MotionBatch bombCoalMotion;
+		const WallBounds walls{ arenaMin.x, arenaMin.y, arenaMax.x, arenaMax.y };
+
+		/* Every explosion and spawning or despawning coal has a timer for its next frame, */
+		/* only the expired ones are visited each tick */
+		const float timerTickLength{ 1.0f / 120.0f };
+		TimingWheel<PoolHandle> explosionTimers{ timerTickLength };
+		/* A wheel per kind of coal, so both coal systems can advance their own */
+		TimingWheel<PoolHandle> basicCoalTimers{ timerTickLength };
+		TimingWheel<PoolHandle> bombCoalTimers{ timerTickLength };
+		/* Scripted game flow, like GameOverSequence() */
+		SequenceRunner sequences{ timerTickLength };
+
 		//---------------------------------//
 		// Object spawn mechanic variables //
 		//---------------------------------//
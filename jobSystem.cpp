@@ -0,0 +1,216 @@
+#include "jobSystem.h"
+
+#include <algorithm>
+
+namespace Tmpl8 {
+
+	struct JobHandle::State
+	{
+		std::atomic<bool> done{ false };
+		/* Guards done being set against jobs being added to continuations */
+		std::mutex mutex;
+		/* Jobs submitted with this job as their dependency */
+		std::vector<JobSystem::Job> continuations;
+	};
+
+	namespace {
+		/* Which system and worker the current thread belongs to, so jobs submitted by a worker go to its deque */
+		thread_local const JobSystem* currentSystem{ nullptr };
+		thread_local unsigned int currentWorker{ JobTiming::NOT_A_WORKER };
+	}
+
+	bool JobHandle::IsDone() const
+	{
+		return !state || state->done.load( std::memory_order_acquire );
+	}
+
+	JobSystem::~JobSystem()
+	{
+		{
+			std::lock_guard<std::mutex> lock( queueMutex );
+			stopping = true;
+		}
+		jobAvailable.notify_all();
+
+		for (auto& worker : workers)
+		{
+			worker->thread.join();
+		}
+	}
+
+	void JobSystem::Start( unsigned int workerCount )
+	{
+		if (!workers.empty()) { return; }
+
+		if (workerCount == 0) { workerCount = DefaultWorkerCount(); }
+
+		/* Every deque exists before the first worker starts stealing */
+		workers.reserve( workerCount );
+		for (unsigned int i = 0; i < workerCount; ++i) { workers.push_back( std::make_unique<Worker>() ); }
+		for (unsigned int i = 0; i < workerCount; ++i) { workers[i]->thread = std::thread( &JobSystem::WorkerLoop, this, i ); }
+	}
+
+	unsigned int JobSystem::DefaultWorkerCount()
+	{
+		/* hardware_concurrency() may return 0 when it can't be determined */
+		const unsigned int hardwareThreads = std::thread::hardware_concurrency();
+		return std::max( hardwareThreads, 2u ) - 1;
+	}
+
+	JobHandle JobSystem::Submit( std::function<void()> job, const char* name, const JobHandle& after )
+	{
+		return Add( std::move( job ), name, false, after );
+	}
+
+	JobHandle JobSystem::SubmitBackground( std::function<void()> job, const char* name )
+	{
+		return Add( std::move( job ), name, true, {} );
+	}
+
+	void JobSystem::Wait( const JobHandle& handle )
+	{
+		const unsigned int self = (currentSystem == this) ? currentWorker : JobTiming::NOT_A_WORKER;
+		/* Without workers nobody else would run the background jobs */
+		const bool takeBackground = workers.empty();
+
+		while (!handle.IsDone())
+		{
+			Job job;
+			if (TryTake( self, takeBackground, job )) { Run( job, self ); }
+			else { std::this_thread::yield(); }
+		}
+	}
+
+	JobHandle JobSystem::Add( std::function<void()> run, const char* name, bool isBackground, const JobHandle& after )
+	{
+		JobHandle handle;
+		handle.state = std::make_shared<JobHandle::State>();
+		Job job{ std::move( run ), handle.state, name, isBackground };
+
+		if (after.state)
+		{
+			std::lock_guard<std::mutex> lock( after.state->mutex );
+			if (!after.state->done.load( std::memory_order_relaxed ))
+			{
+				after.state->continuations.push_back( std::move( job ) );
+				return handle;
+			}
+		}
+
+		Enqueue( std::move( job ) );
+		return handle;
+	}
+
+	void JobSystem::Enqueue( Job&& job )
+	{
+		/* Counted before the job can be taken, so taking it never brings pending below 0 */
+		/* and under the lock the workers sleep on, so a worker can't miss it */
+		if (!job.background && currentSystem == this && currentWorker < workers.size())
+		{
+			{
+				std::lock_guard<std::mutex> lock( queueMutex );
+				pending++;
+			}
+
+			Worker& worker = *workers[currentWorker];
+			std::lock_guard<std::mutex> lock( worker.mutex );
+			worker.jobs.push_back( std::move( job ) );
+		}
+		else
+		{
+			std::lock_guard<std::mutex> lock( queueMutex );
+			pending++;
+			(job.background ? background : submitted).push_back( std::move( job ) );
+		}
+		jobAvailable.notify_one();
+	}
+
+	bool JobSystem::TryTake( unsigned int worker, bool takeBackground, Job& job )
+	{
+		const unsigned int workerCount = static_cast<unsigned int>(workers.size());
+
+		/* The own deque is used as a stack, the newest job is most likely still in the cache */
+		if (worker < workerCount)
+		{
+			Worker& own = *workers[worker];
+			std::lock_guard<std::mutex> lock( own.mutex );
+			if (!own.jobs.empty())
+			{
+				job = std::move( own.jobs.back() );
+				own.jobs.pop_back();
+				pending--;
+				return true;
+			}
+		}
+
+		/* Steal the oldest job of another worker, starting at the next one to spread the stealing */
+		for (unsigned int i = 1; i <= workerCount; ++i)
+		{
+			const unsigned int victim = (worker < workerCount ? worker + i : i - 1) % workerCount;
+			if (victim == worker) { continue; }
+
+			Worker& other = *workers[victim];
+			std::lock_guard<std::mutex> lock( other.mutex );
+			if (!other.jobs.empty())
+			{
+				job = std::move( other.jobs.front() );
+				other.jobs.pop_front();
+				pending--;
+				return true;
+			}
+		}
+
+		std::lock_guard<std::mutex> lock( queueMutex );
+		std::deque<Job>* queue = !submitted.empty() ? &submitted : (takeBackground && !background.empty()) ? &background : nullptr;
+		if (!queue) { return false; }
+
+		job = std::move( queue->front() );
+		queue->pop_front();
+		pending--;
+		return true;
+	}
+
+	void JobSystem::Run( Job& job, unsigned int worker )
+	{
+		if (timingHook)
+		{
+			const auto start = std::chrono::steady_clock::now();
+			job.run();
+			timingHook( { job.name, worker, start, std::chrono::steady_clock::now() } );
+		}
+		else
+		{
+			job.run();
+		}
+
+		std::vector<Job> continuations;
+		{
+			std::lock_guard<std::mutex> lock( job.state->mutex );
+			job.state->done.store( true, std::memory_order_release );
+			continuations.swap( job.state->continuations );
+		}
+		for (Job& continuation : continuations) { Enqueue( std::move( continuation ) ); }
+	}
+
+	void JobSystem::WorkerLoop( unsigned int index )
+	{
+		currentSystem = this;
+		currentWorker = index;
+
+		while (true)
+		{
+			Job job;
+			if (TryTake( index, true, job ))
+			{
+				Run( job, index );
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock( queueMutex );
+			jobAvailable.wait( lock, [this] { return stopping || pending > 0; } );
+
+			/* Only stop once every queued job has run */
+			if (stopping && pending == 0) { return; }
+		}
+	}
+}
\ No newline at end of file
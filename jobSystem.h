@@ -0,0 +1,141 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Tmpl8 {
+
+	/* Refers to a submitted job, stays valid after the job has run */
+	class JobHandle
+	{
+	public:
+		[[nodiscard]] bool IsValid() const { return state != nullptr; }
+		/* An invalid handle counts as done */
+		[[nodiscard]] bool IsDone() const;
+
+	private:
+		friend class JobSystem;
+
+		struct State;
+		std::shared_ptr<State> state;
+	};
+
+	/* Passed to the timing hook after every job */
+	struct JobTiming
+	{
+		/* Set as the worker when the job ran on a thread that was waiting, like the main thread */
+		static constexpr unsigned int NOT_A_WORKER{ UINT_MAX };
+
+		const char* name;
+		unsigned int worker;
+		std::chrono::steady_clock::time_point start;
+		std::chrono::steady_clock::time_point end;
+	};
+
+	/* Worker threads that each have their own deque of jobs, and steal from the others when it runs empty */
+	/* Jobs submitted by a worker go to its own deque, the others to a shared queue */
+	/* Threads that wait on a job run other jobs in the meantime, so waiting from within a job is fine */
+	class JobSystem
+	{
+	public:
+		JobSystem() = default;
+		/* Finishes every queued job before joining the workers */
+		~JobSystem();
+
+		JobSystem( const JobSystem& ) = delete;
+		JobSystem& operator=( const JobSystem& ) = delete;
+
+		JobSystem( JobSystem&& ) = delete;
+		JobSystem& operator=( JobSystem&& ) = delete;
+
+		/* Starts the workers, a workerCount of 0 creates one per hardware thread, minus the main thread */
+		/* Jobs submitted before only run once the workers start, or when a thread waits on them */
+		void Start( unsigned int workerCount = 0 );
+		/* The amount of workers Start() creates for a workerCount of 0 */
+		[[nodiscard]] static unsigned int DefaultWorkerCount();
+
+		/* Queues a job, when after is valid the job is only queued once that job is done */
+		JobHandle Submit( std::function<void()> job, const char* name = nullptr, const JobHandle& after = {} );
+		/* Queues a long job, like decoding an asset, that only the workers run */
+		/* Waiting threads don't help with these, so waiting on a short job doesn't end up decoding an image */
+		JobHandle SubmitBackground( std::function<void()> job, const char* name = nullptr );
+		/* Runs other jobs until the job is done */
+		void Wait( const JobHandle& handle );
+		/* Calls body( first, last ) for chunks of at most grainSize indices of [begin, end) in parallel */
+		/* Returns once every chunk is done, the calling thread runs the first chunk itself */
+		template <typename Body>
+		void ParallelFor( size_t begin, size_t end, size_t grainSize, Body body, const char* name = nullptr );
+
+		/* Called after every job, on the thread that ran it, set it before Start() */
+		void SetTimingHook( std::function<void( const JobTiming& )> hook ) { timingHook = std::move( hook ); }
+
+		[[nodiscard]] unsigned int GetWorkerCount() const { return static_cast<unsigned int>(workers.size()); }
+
+	private:
+		struct Job
+		{
+			std::function<void()> run;
+			std::shared_ptr<JobHandle::State> state;
+			const char* name{ nullptr };
+			bool background{ false };
+		};
+
+		struct Worker
+		{
+			std::thread thread;
+			std::mutex mutex;
+			std::deque<Job> jobs;
+		};
+
+		friend class JobHandle;
+
+		JobHandle Add( std::function<void()> job, const char* name, bool background, const JobHandle& after );
+		void Enqueue( Job&& job );
+		/* Takes a job from the worker's own deque (newest first), another worker's (oldest first) */
+		/* or the shared queues, returns false when there is none */
+		bool TryTake( unsigned int worker, bool takeBackground, Job& job );
+		/* Runs the job, then queues the jobs that were waiting on it */
+		void Run( Job& job, unsigned int worker );
+		void WorkerLoop( unsigned int index );
+
+		std::vector<std::unique_ptr<Worker>> workers;
+
+		std::mutex queueMutex;
+		std::condition_variable jobAvailable;
+		/* Jobs submitted from outside of the workers */
+		std::deque<Job> submitted;
+		std::deque<Job> background;
+		/* Queued jobs that haven't been taken yet, over all deques */
+		std::atomic<size_t> pending{ 0 };
+		bool stopping{ false };
+
+		std::function<void( const JobTiming& )> timingHook;
+	};
+
+	template <typename Body>
+	void JobSystem::ParallelFor( size_t begin, size_t end, size_t grainSize, Body body, const char* name )
+	{
+		if (begin >= end) { return; }
+		if (grainSize == 0) { grainSize = 1; }
+
+		std::vector<JobHandle> chunks;
+		chunks.reserve( (end - begin - 1) / grainSize );
+		for (size_t first = begin + grainSize; first < end; first += grainSize)
+		{
+			const size_t last = (end - first < grainSize) ? end : first + grainSize;
+			chunks.push_back( Submit( [&body, first, last] { body( first, last ); }, name ) );
+		}
+
+		body( begin, (end - begin < grainSize) ? end : begin + grainSize );
+		for (const JobHandle& chunk : chunks) { Wait( chunk ); }
+	}
+}
\ No newline at end of file
@@ -0,0 +1,155 @@
+#include "motionBatch.h"
+
+#include <emmintrin.h>
+
+namespace Tmpl8 {
+
+	void MotionBatch::Grow( size_t size )
+	{
+		if (size <= x.size()) { return; }
+
+		x.resize( size );
+		y.resize( size );
+		dx.resize( size );
+		dy.resize( size );
+		speed.resize( size );
+		r.resize( size );
+		hitWall.resize( size );
+	}
+
+	void MotionBatch::Set( size_t row, vec2 pos, vec2 dir, float _speed, float radius )
+	{
+		SetPos( row, pos );
+		SetDir( row, dir );
+		speed[row] = _speed;
+		r[row] = radius;
+		hitWall[row] = 0;
+	}
+
+	namespace {
+
+		/* Same checks as the scalar wall collision the entities used to do themselves */
+		/* Only one of the two walls of an axis is checked when the first one is hit */
+		__m128 ClampAxis( __m128& pos, __m128 radius, __m128 min, __m128 max )
+		{
+			const __m128 one = _mm_set1_ps( 1.0f );
+			const __m128 low = _mm_cmplt_ps( _mm_sub_ps( pos, radius ), min );
+			const __m128 high = _mm_andnot_ps( low, _mm_cmpge_ps( _mm_sub_ps( _mm_add_ps( pos, radius ), one ), max ) );
+
+			pos = _mm_or_ps( _mm_and_ps( low, _mm_add_ps( min, radius ) ),
+				_mm_or_ps( _mm_and_ps( high, _mm_sub_ps( max, radius ) ),
+					_mm_andnot_ps( _mm_or_ps( low, high ), pos ) ) );
+			return _mm_or_ps( low, high );
+		}
+
+		bool ClampAxis( float& pos, float radius, float min, float max )
+		{
+			if (pos - radius < min)
+			{
+				pos = min + radius;
+				return true;
+			}
+			if ((pos + radius - 1.0f) >= max)
+			{
+				pos = max - radius;
+				return true;
+			}
+			return false;
+		}
+
+		/* Shared by both kernels, reflect decides if the velocities are flipped on a hit */
+		void Process( MotionBatch& batch, float deltaTime, WallBounds walls, bool integrate, bool reflect )
+		{
+			const size_t size = batch.Size();
+			float* x = batch.x.data();
+			float* y = batch.y.data();
+			float* dx = batch.dx.data();
+			float* dy = batch.dy.data();
+			const float* speed = batch.speed.data();
+			const float* r = batch.r.data();
+
+			const __m128 dt = _mm_set1_ps( deltaTime );
+			const __m128 minX = _mm_set1_ps( walls.min_x );
+			const __m128 minY = _mm_set1_ps( walls.min_y );
+			const __m128 maxX = _mm_set1_ps( walls.max_x );
+			const __m128 maxY = _mm_set1_ps( walls.max_y );
+			const __m128 signBit = _mm_set1_ps( -0.0f );
+
+			/* 4 entities at a time */
+			size_t i = 0;
+			for (; i + 4 <= size; i += 4)
+			{
+				__m128 px = _mm_loadu_ps( x + i );
+				__m128 py = _mm_loadu_ps( y + i );
+				const __m128 dirX = _mm_loadu_ps( dx + i );
+				const __m128 dirY = _mm_loadu_ps( dy + i );
+				const __m128 radius = _mm_loadu_ps( r + i );
+
+				if (integrate)
+				{
+					/* Same order of operations as the scalar movement, dir * speed * deltaTime */
+					const __m128 entitySpeed = _mm_loadu_ps( speed + i );
+					px = _mm_add_ps( px, _mm_mul_ps( _mm_mul_ps( dirX, entitySpeed ), dt ) );
+					py = _mm_add_ps( py, _mm_mul_ps( _mm_mul_ps( dirY, entitySpeed ), dt ) );
+				}
+
+				const __m128 hitX = ClampAxis( px, radius, minX, maxX );
+				const __m128 hitY = ClampAxis( py, radius, minY, maxY );
+				_mm_storeu_ps( x + i, px );
+				_mm_storeu_ps( y + i, py );
+
+				if (reflect)
+				{
+					_mm_storeu_ps( dx + i, _mm_xor_ps( dirX, _mm_and_ps( hitX, signBit ) ) );
+					_mm_storeu_ps( dy + i, _mm_xor_ps( dirY, _mm_and_ps( hitY, signBit ) ) );
+				}
+
+				const int maskX = _mm_movemask_ps( hitX );
+				const int maskY = _mm_movemask_ps( hitY );
+				for (int lane = 0; lane < 4; ++lane)
+				{
+					batch.hitWall[i + lane] = static_cast<uint8_t>(
+						(((maskX >> lane) & 1) ? HitWallX : 0) | (((maskY >> lane) & 1) ? HitWallY : 0) );
+				}
+			}
+
+			/* The remaining entities one at a time */
+			for (; i < size; ++i)
+			{
+				if (integrate)
+				{
+					x[i] += dx[i] * speed[i] * deltaTime;
+					y[i] += dy[i] * speed[i] * deltaTime;
+				}
+
+				const bool hitX = ClampAxis( x[i], r[i], walls.min_x, walls.max_x );
+				const bool hitY = ClampAxis( y[i], r[i], walls.min_y, walls.max_y );
+
+				if (reflect)
+				{
+					if (hitX) { dx[i] = -dx[i]; }
+					if (hitY) { dy[i] = -dy[i]; }
+				}
+
+				batch.hitWall[i] = static_cast<uint8_t>((hitX ? HitWallX : 0) | (hitY ? HitWallY : 0));
+			}
+		}
+	}
+
+	void IntegrateAndReflect( MotionBatch& batch, float deltaTime, WallBounds walls )
+	{
+		Process( batch, deltaTime, walls, true, true );
+	}
+
+	void ClampToWalls( MotionBatch& batch, WallBounds walls )
+	{
+		Process( batch, 0.0f, walls, false, false );
+	}
+
+	void ClampRowToWalls( MotionBatch& batch, size_t row, WallBounds walls )
+	{
+		const bool hitX = ClampAxis( batch.x[row], batch.r[row], walls.min_x, walls.max_x );
+		const bool hitY = ClampAxis( batch.y[row], batch.r[row], walls.min_y, walls.max_y );
+		batch.hitWall[row] = static_cast<uint8_t>((hitX ? HitWallX : 0) | (hitY ? HitWallY : 0));
+	}
+}
\ No newline at end of file
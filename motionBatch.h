@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "template.h"
+
+namespace Tmpl8 {
+
+	/* Set in MotionBatch::hitWall when an entity hit a side wall or the top/bottom wall */
+	constexpr uint8_t HitWallX{ 1 << 0 };
+	constexpr uint8_t HitWallY{ 1 << 1 };
+
+	/* Positions, directions, speeds and radii in separate arrays, so the wall kernels */
+	/* can process 4 entities per SSE instruction */
+	/* A row per slot of the entities' pool, a bound entity reads and writes its motion in its row */
+	/* (see Entity::BindMotion()), the rows of free slots are processed too but never read */
+	/* Pools hand out the lowest slots first, so the rows only go up to the most entities alive at once */
+	struct MotionBatch
+	{
+		/* Adds rows until there are at least size, the existing rows keep their values */
+		void Grow( size_t size );
+		void Set( size_t row, vec2 pos, vec2 dir, float speed, float radius );
+		[[nodiscard]] size_t Size() const { return x.size(); }
+		[[nodiscard]] vec2 GetPos( size_t row ) const { return { x[row], y[row] }; }
+		[[nodiscard]] vec2 GetDir( size_t row ) const { return { dx[row], dy[row] }; }
+		void SetPos( size_t row, vec2 pos ) { x[row] = pos.x; y[row] = pos.y; }
+		void SetDir( size_t row, vec2 dir ) { dx[row] = dir.x; dy[row] = dir.y; }
+
+		std::vector<float> x, y;
+		std::vector<float> dx, dy;
+		std::vector<float> speed;
+		std::vector<float> r;
+		/* HitWallX and/or HitWallY, per row, set by the last kernel that processed the batch */
+		std::vector<uint8_t> hitWall;
+	};
+
+	/* Bounds of the area within the walls, matches the walls in Entity */
+	struct WallBounds
+	{
+		float min_x, min_y;
+		float max_x, max_y;
+	};
+
+	/* Moves every entity by its direction times its speed, and keeps it within the walls */
+	/* An entity that hits a wall is put against it and its direction is reflected on that axis */
+	void IntegrateAndReflect( MotionBatch& batch, float deltaTime, WallBounds walls );
+	/* Puts every entity that is (partly) outside of the walls against them, directions are ignored */
+	void ClampToWalls( MotionBatch& batch, WallBounds walls );
+	/* ClampToWalls() for a single row, for an entity that has to be within the walls right after it moved */
+	void ClampRowToWalls( MotionBatch& batch, size_t row, WallBounds walls );
+}
\ No newline at end of file
@@ -0,0 +1,122 @@
+#include "occupancyGrid.h"
+
+#include <cassert>
+#include <cstdlib>
+
+namespace Tmpl8 {
+
+	OccupancyGrid::OccupancyGrid( vec2 _min, vec2 _max, float _cellSize, size_t maxIds )
+		: min( _min )
+		, max( _max )
+		, cellSize( _cellSize )
+		, footprints( maxIds )
+	{
+		columns = Max( static_cast<int>(ceilf( (_max.x - _min.x) / _cellSize )), 1 );
+		rows = Max( static_cast<int>(ceilf( (_max.y - _min.y) / _cellSize )), 1 );
+
+		const size_t cellCount = static_cast<size_t>(columns * rows);
+		blockedBy.assign( cellCount, 0 );
+		freeCells.reserve( cellCount );
+		freeIndex.resize( cellCount );
+		for (int c = 0; c < static_cast<int>(cellCount); ++c)
+		{
+			freeIndex[c] = c;
+			freeCells.push_back( c );
+		}
+	}
+
+	void OccupancyGrid::BeginUpdate()
+	{
+		update++;
+	}
+
+	void OccupancyGrid::Set( size_t id, vec2 pos, float clearance )
+	{
+		assert( id < footprints.size() && "OccupancyGrid id out of range" );
+		Footprint& footprint = footprints[id];
+		footprint.update = update;
+
+		const int x = CellX( pos.x );
+		const int y = CellY( pos.y );
+		if (x == footprint.x && y == footprint.y && clearance == footprint.clearance) { return; }
+
+		Block( footprint, -1 );
+		footprint.x = x;
+		footprint.y = y;
+		footprint.clearance = clearance;
+		Block( footprint, 1 );
+	}
+
+	void OccupancyGrid::EndUpdate()
+	{
+		for (Footprint& footprint : footprints)
+		{
+			if (footprint.x < 0 || footprint.update == update) { continue; }
+
+			Block( footprint, -1 );
+			footprint.x = -1;
+			footprint.y = -1;
+		}
+	}
+
+	void OccupancyGrid::Clear()
+	{
+		/* No entity is Set() in a new update, so EndUpdate() removes them all */
+		BeginUpdate();
+		EndUpdate();
+	}
+
+	bool OccupancyGrid::IsFree( vec2 pos ) const
+	{
+		if (pos.x < min.x || pos.y < min.y || pos.x >= max.x || pos.y >= max.y) { return true; }
+
+		return blockedBy[CellY( pos.y ) * columns + CellX( pos.x )] == 0;
+	}
+
+	void OccupancyGrid::Block( const Footprint& footprint, int delta )
+	{
+		if (footprint.x < 0 || footprint.clearance <= 0.0f) { return; }
+
+		/* A cell is blocked when the gap between it and the entity's cell is shorter than the clearance */
+		const int reach = static_cast<int>(ceilf( footprint.clearance / cellSize ));
+		const float squaredClearance = footprint.clearance * footprint.clearance;
+
+		for (int y = Max( footprint.y - reach, 0 ); y <= Min( footprint.y + reach, rows - 1 ); ++y)
+		{
+			const float gapY = static_cast<float>(Max( abs( y - footprint.y ) - 1, 0 )) * cellSize;
+			for (int x = Max( footprint.x - reach, 0 ); x <= Min( footprint.x + reach, columns - 1 ); ++x)
+			{
+				const float gapX = static_cast<float>(Max( abs( x - footprint.x ) - 1, 0 )) * cellSize;
+				if (gapX * gapX + gapY * gapY >= squaredClearance) { continue; }
+
+				const int cell = y * columns + x;
+				if (delta > 0 && blockedBy[cell]++ == 0)
+				{
+					/* The cell is no longer free, move the last free cell into its place */
+					const int last = freeCells.back();
+					freeCells[freeIndex[cell]] = last;
+					freeIndex[last] = freeIndex[cell];
+					freeCells.pop_back();
+					freeIndex[cell] = -1;
+				}
+				else if (delta < 0 && --blockedBy[cell] == 0)
+				{
+					freeIndex[cell] = static_cast<int>(freeCells.size());
+					freeCells.push_back( cell );
+				}
+			}
+		}
+	}
+
+	int OccupancyGrid::CellX( float x ) const
+	{
+		/* Entities outside of the grid are put in the nearest border cell, which only moves them closer to */
+		/* the cells, so they still block every cell they should */
+		return static_cast<int>(Clamp( floorf( (x - min.x) / cellSize ), 0.0f, static_cast<float>(columns - 1) ));
+	}
+
+	int OccupancyGrid::CellY( float y ) const
+	{
+		return static_cast<int>(Clamp( floorf( (y - min.y) / cellSize ), 0.0f, static_cast<float>(rows - 1) ));
+	}
+}
\ No newline at end of file
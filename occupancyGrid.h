@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "template.h"
+
+namespace Tmpl8 {
+
+	/* Grid over the spawn area that knows which cells are far enough away from every entity to spawn in */
+	/* Each entity blocks the cells within its clearance of the cell it is in, so every point in a free cell */
+	/* is at least the clearance away from it. Entities are kept by id and only re-blocked when they change cell */
+	/* The free cells are kept in a list, so a random free cell is found in O(1) */
+	class OccupancyGrid
+	{
+	public:
+		OccupancyGrid( vec2 min, vec2 max, float cellSize, size_t maxIds );
+
+		/* Call once per tick, then Set() every entity, then EndUpdate() */
+		void BeginUpdate();
+		/* Moves the entity with the given id to pos, ids must be below maxIds */
+		void Set( size_t id, vec2 pos, float clearance );
+		/* Removes the entities that weren't Set() since BeginUpdate() */
+		void EndUpdate();
+		/* Removes every entity */
+		void Clear();
+
+		/* Returns false for positions in a blocked cell, positions outside of the grid are free */
+		[[nodiscard]] bool IsFree( vec2 pos ) const;
+		/* Picks a random position in a random free cell, returns false when every cell is blocked */
+		template <typename Rng>
+		[[nodiscard]] bool Sample( Rng& rng, vec2& pos ) const;
+		[[nodiscard]] size_t FreeCells() const { return freeCells.size(); }
+
+	private:
+		struct Footprint
+		{
+			/* Cell the entity is in, -1 when it isn't in the grid */
+			int x{ -1 };
+			int y{ -1 };
+			float clearance{ 0.0f };
+			/* The update in which the entity was last Set() */
+			unsigned int update{ 0 };
+		};
+
+		/* Adds delta to the count of every cell the footprint blocks */
+		void Block( const Footprint& footprint, int delta );
+
+		[[nodiscard]] int CellX( float x ) const;
+		[[nodiscard]] int CellY( float y ) const;
+
+		vec2 min;
+		vec2 max;
+		float cellSize{ 0.0f };
+		int columns{ 1 };
+		int rows{ 1 };
+		unsigned int update{ 0 };
+
+		std::vector<Footprint> footprints;
+		/* Per cell, how many entities block it */
+		std::vector<unsigned int> blockedBy;
+		/* Cells that no entity blocks, in no particular order */
+		std::vector<int> freeCells;
+		/* Per cell, where it is in freeCells, -1 when blocked */
+		std::vector<int> freeIndex;
+	};
+
+	template <typename Rng>
+	bool OccupancyGrid::Sample( Rng& rng, vec2& pos ) const
+	{
+		if (freeCells.empty()) { return false; }
+
+		const int cell = freeCells[std::uniform_int_distribution<size_t>{ 0, freeCells.size() - 1 }( rng )];
+		const float x0 = min.x + static_cast<float>(cell % columns) * cellSize;
+		const float y0 = min.y + static_cast<float>(cell / columns) * cellSize;
+
+		/* The last column and row can stick out of the grid */
+		pos.x = std::uniform_real_distribution<float>{ x0, Min( x0 + cellSize, max.x ) }( rng );
+		pos.y = std::uniform_real_distribution<float>{ y0, Min( y0 + cellSize, max.y ) }( rng );
+		return true;
+	}
+}
\ No newline at end of file
@@ -9,9 +9,9 @@
 
 namespace Tmpl8 {
 
-	Player::Player( shared_ptr<Sprite> _sprite, shared_ptr<Sprite> _mushroom, 
+	Player::Player( SpriteId _sprite, shared_ptr<Sprite> _mushroom, 
 		vec2 _centerPos, float _hitBoxRadius, float _speed )
-		: Entity( std::move( _sprite ), _centerPos, _hitBoxRadius, _speed )
+		: Entity( _sprite, _centerPos, _hitBoxRadius, _speed )
 		, mushroom_sprite( std::move(_mushroom) )
 	{
 		/* Puts the player in the middle of the screen */
@@ -33,9 +33,7 @@ namespace Tmpl8 {
 		/* lround improves the rounding off */
 		frame = static_cast<unsigned int>(lround(fmodf( angle, 360.0f ) / 6.0f));
 		frame = (frame < 0) ? 0 : (frame > 59) ? 59 : frame;
-		
-		sprite->SetFrame( frame );
-		mushroom_sprite->SetFrame( frame );
+		aimFrame = frame;
 	}
 
 	// Check collision before moving the player.
@@ -165,7 +163,8 @@ namespace Tmpl8 {
 		if (immuneLastTick && immunityTimer > 0.0f)
 		{
 			flashRed = true;
-			immuneSwitchTimer = maxTimeBetweenImmuneSwitch;
+			immuneSwitchTimer.Clear();
+			immuneSwitchTimer.Schedule( maxTimeBetweenImmuneSwitch, false );
 		}
 		immuneLastTick = (immunityTimer <= 0.0f);
 
@@ -192,10 +191,10 @@ namespace Tmpl8 {
 				{
 					for (int i = boostFrameCount - offset; i >= 0; i -= decrement)
 					{
-						sprite->DrawBlend( screen,
+						GetSprite()->DrawBlend( screen,
 							static_cast<int>(previousPos[i].x - halfWidth),
 							static_cast<int>(previousPos[i].y - halfHeight),
-							1.0f / static_cast<float>(i + 2),
+							frame, 1.0f / static_cast<float>(i + 2),
 							shadowOffset, shadowOffset, shadowFadeLength, 0x000000, 0.8f / static_cast<float>(i + 2) );
 					}
 				}
@@ -203,10 +202,10 @@ namespace Tmpl8 {
 				{
 					for (int i = size - offset; i >= 0; i -= decrement)
 					{
-						sprite->DrawBlend( screen,
+						GetSprite()->DrawBlend( screen,
 							static_cast<int>(previousPos[i].x - halfWidth),
 							static_cast<int>(previousPos[i].y - halfHeight),
-							1.0f / static_cast<float>(i + 2),
+							frame, 1.0f / static_cast<float>(i + 2),
 							shadowOffset, shadowOffset, shadowFadeLength, 0x000000, 0.8f / static_cast<float>(i + 2) );
 					}
 				}
@@ -218,10 +217,10 @@ namespace Tmpl8 {
 				{
 					for (int i = boostFrameCount - offset; i >= 0; i -= decrement)
 					{
-						sprite->DrawInColorAndBlend( screen,
+						GetSprite()->DrawInColorAndBlend( screen,
 							static_cast<int>(previousPos[i].x - halfWidth),
 							static_cast<int>(previousPos[i].y - halfHeight),
-							hitColor,
+							frame, hitColor,
 							1.0f / static_cast<float>(i + 2) );
 					}
 				}
@@ -229,10 +228,10 @@ namespace Tmpl8 {
 				{
 					for (int i = size - offset; i >= 0; i -= decrement)
 					{
-						sprite->DrawInColorAndBlend( screen,
+						GetSprite()->DrawInColorAndBlend( screen,
 							static_cast<int>(previousPos[i].x - halfWidth),
 							static_cast<int>(previousPos[i].y - halfHeight),
-							hitColor,
+							frame, hitColor,
 							1.0f / static_cast<float>(i + 2) );
 					}
 				}
@@ -241,10 +240,10 @@ namespace Tmpl8 {
 
 		if (immunityTimer <= 0)
 		{
-			sprite->DrawWithShadow( screen,
+			GetSprite()->DrawWithShadow( screen,
 				static_cast<int>(centerPos.x - halfWidth),
 				static_cast<int>(centerPos.y - halfHeight),
-				shadowOffset, shadowOffset, shadowFadeLength,
+				frame, shadowOffset, shadowOffset, shadowFadeLength,
 				0x000000, 0.5f );
 
 			collisionWithGoldCoal = false;
@@ -255,37 +254,36 @@ namespace Tmpl8 {
 			if (collisionWithGoldCoal)
 			{
 				/* Collided with GoldCoal, draw in gold */
-				sprite->DrawInColor( screen,
+				GetSprite()->DrawInColor( screen,
 					static_cast<int>(centerPos.x - halfWidth),
 					static_cast<int>(centerPos.y - halfHeight),
-					goldColor );
+					frame, goldColor );
 			}
 			else
 			{
 				/* Hit by an enemy, draw in red */
-				sprite->DrawInColor( screen,
+				GetSprite()->DrawInColor( screen,
 					static_cast<int>(centerPos.x - halfWidth),
 					static_cast<int>(centerPos.y - halfHeight),
-					hitColor );
+					frame, hitColor );
 			}
 		}
 		else // !flashRed
 		{
-			sprite->DrawInBlendedColor( screen,
+			GetSprite()->DrawInBlendedColor( screen,
 				static_cast<int>(centerPos.x - halfWidth),
 				static_cast<int>(centerPos.y - halfHeight),
-				0x000000,
+				frame, 0x000000,
 				0.25f,
 				shadowOffset, shadowOffset, shadowFadeLength, 0x000000, 0.5f );
 		}
 
 		/* Update the switch timer */
-		immuneSwitchTimer -= dt;
-		if (immuneSwitchTimer <= 0)
+		immuneSwitchTimer.Advance( dt, [this]( bool switchTo )
 		{
-			immuneSwitchTimer = maxTimeBetweenImmuneSwitch;
-			flashRed = !flashRed;
-		}
+			flashRed = switchTo;
+			immuneSwitchTimer.Schedule( maxTimeBetweenImmuneSwitch, !switchTo );
+		} );
 	}
 
 	void Player::DrawDead(Surface* screen) const
@@ -296,10 +294,10 @@ namespace Tmpl8 {
 			return;
 		}
 
-		sprite->DrawInBlendedColor( screen, 
+		GetSprite()->DrawInBlendedColor( screen, 
 			static_cast<int>(centerPos.x - halfWidth),
 			static_cast<int>(centerPos.y - halfHeight), 
-			0x0000ff, 0.25f );
+			frame, 0x0000ff, 0.25f );
 	}
 
 	void Player::DrawMushroom( Surface* screen )
@@ -324,7 +322,7 @@ namespace Tmpl8 {
 						mushroom_sprite->DrawBlend( screen,
 							static_cast<int>(previousPos[i].x - halfWidth),
 							static_cast<int>(previousPos[i].y - halfHeight),
-							1.0f / static_cast<float>(i + 2),
+							frame, 1.0f / static_cast<float>(i + 2),
 							shadowOffset, shadowOffset, shadowFadeLength, 0x000000, 0.8f / static_cast<float>(i + 2) );
 					}
 				}
@@ -335,7 +333,7 @@ namespace Tmpl8 {
 						mushroom_sprite->DrawBlend( screen,
 							static_cast<int>(previousPos[i].x - halfWidth),
 							static_cast<int>(previousPos[i].y - halfHeight),
-							1.0f / static_cast<float>(i + 2),
+							frame, 1.0f / static_cast<float>(i + 2),
 							shadowOffset, shadowOffset, shadowFadeLength, 0x000000, 0.8f / static_cast<float>(i + 2) );
 					}
 				}
@@ -350,7 +348,7 @@ namespace Tmpl8 {
 						mushroom_sprite->DrawInColorAndBlend( screen,
 							static_cast<int>(previousPos[i].x - halfWidth),
 							static_cast<int>(previousPos[i].y - halfHeight),
-							hitColor,
+							frame, hitColor,
 							1.0f / static_cast<float>(i + 2) );
 					}
 				}
@@ -361,7 +359,7 @@ namespace Tmpl8 {
 						mushroom_sprite->DrawInColorAndBlend( screen,
 							static_cast<int>(previousPos[i].x - halfWidth),
 							static_cast<int>(previousPos[i].y - halfHeight),
-							hitColor,
+							frame, hitColor,
 							1.0f / static_cast<float>(i + 2) );
 					}
 				}
@@ -373,7 +371,7 @@ namespace Tmpl8 {
 			mushroom_sprite->DrawWithShadow( screen,
 				static_cast<int>(centerPos.x - halfWidth),
 				static_cast<int>(centerPos.y - halfHeight),
-				shadowOffset, shadowOffset, shadowFadeLength,
+				frame, shadowOffset, shadowOffset, shadowFadeLength,
 				0x000000, 0.5f );
 
 			collisionWithGoldCoal = false;
@@ -387,7 +385,7 @@ namespace Tmpl8 {
 				mushroom_sprite->DrawInColor( screen,
 					static_cast<int>(centerPos.x - halfWidth),
 					static_cast<int>(centerPos.y - halfHeight),
-					goldColor );
+					frame, goldColor );
 			}
 			else
 			{
@@ -395,7 +393,7 @@ namespace Tmpl8 {
 				mushroom_sprite->DrawInColor( screen,
 					static_cast<int>(centerPos.x - halfWidth),
 					static_cast<int>(centerPos.y - halfHeight),
-					hitColor );
+					frame, hitColor );
 			}
 		}
 		else // !flashRed
@@ -403,18 +401,17 @@ namespace Tmpl8 {
 			mushroom_sprite->DrawInBlendedColor( screen,
 				static_cast<int>(centerPos.x - halfWidth),
 				static_cast<int>(centerPos.y - halfHeight),
-				0x000000,
+				frame, 0x000000,
 				0.25f,
 				shadowOffset, shadowOffset, shadowFadeLength, 0x000000, 0.5f );
 		}
 
 		/* Update the switch timer */
-		immuneSwitchTimer -= dt;
-		if (immuneSwitchTimer <= 0)
+		immuneSwitchTimer.Advance( dt, [this]( bool switchTo )
 		{
-			immuneSwitchTimer = maxTimeBetweenImmuneSwitch;
-			flashRed = !flashRed;
-		}
+			flashRed = switchTo;
+			immuneSwitchTimer.Schedule( maxTimeBetweenImmuneSwitch, !switchTo );
+		} );
 	}
 
 	void Player::DrawDeadMushroom(Surface* screen) const
@@ -422,6 +419,6 @@ namespace Tmpl8 {
 		mushroom_sprite->DrawInBlendedColor( screen,
 			static_cast<int>(centerPos.x - halfWidth),
 			static_cast<int>(centerPos.y - halfHeight),
-			0x0000ff, 0.25f );
+			frame, 0x0000ff, 0.25f );
 	}
 }
\ No newline at end of file
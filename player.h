@@ -1,6 +1,7 @@
 #pragma once
 
 #include "entity.h"
+#include "timingWheel.h"
 
 #include <array>
 
@@ -12,7 +13,7 @@ namespace Tmpl8 {
 	{
 	public:
 		/* Constructor */
-		Player( shared_ptr<Sprite> sprite, shared_ptr<Sprite> mushroom, 
+		Player( SpriteId sprite, shared_ptr<Sprite> mushroom, 
 			vec2 centerPos, float hitBoxRadius, float speed );
 
 		void Update( float deltaTime ) override { /* UNIMPLEMENTED */ }
@@ -25,13 +26,13 @@ namespace Tmpl8 {
 		void DrawMushroom( Surface* screen );
 		void DrawDeadMushroom( Surface* screen ) const;
 
-		/* Calculates and sets the sprite's current frame based on player and mouse coordinates */
+		/* Calculates the frame to draw the player with based on player and mouse coordinates */
 		void CalcSetFrame( int mousex, int mousey );
 		/* Sets up the movement, which is applied in Update */
 		void SetMovement( float dx, float dy );
 		void reduceHitPoints( int damage );
 
-		static unsigned int GetFrame() { return frame; }
+		static unsigned int GetFrame() { return aimFrame; }
 		bool IsFlashingRed() { return flashRed; }
 		[[nodiscard]] int GetHitPoints() const { return hitPoints; }
 		void SetHitPoints( int hp ) { hitPoints = hp; }
@@ -42,11 +43,14 @@ namespace Tmpl8 {
 		void SetPosY( float y ) { centerPos.y = y; }
 		void SetImmunity( float time ) { immunityTimer = time; }
 		void SetHitByGoldCoal() { collisionWithGoldCoal = true; }
-		void ActivateMushroomMan() { mushroomMan = true; }
-		[[nodiscard]] float GetWidth() const { return static_cast<float>(sprite->GetWidth()); }
-		[[nodiscard]] float GetHeight() const { return static_cast<float>(sprite->GetHeight()); }
+		/* The mushroom man sprite is only loaded once the secret mode is entered */
+		void ActivateMushroomMan( shared_ptr<Sprite> mushroom ) { mushroom_sprite = std::move( mushroom ); mushroomMan = true; }
+		void DeactivateMushroomMan() { mushroom_sprite.reset(); mushroomMan = false; }
+		[[nodiscard]] float GetWidth() const { return static_cast<float>(GetSprite()->GetWidth()); }
+		[[nodiscard]] float GetHeight() const { return static_cast<float>(GetSprite()->GetHeight()); }
 
 	private:
+		/* Not in the SpriteRegistry, holding it keeps the sprite cache from unloading it */
 		shared_ptr<Sprite> mushroom_sprite;
 		/* Should the mushroom man sprite be displayed instead of the default one */
 		bool mushroomMan{ false };
@@ -62,9 +66,10 @@ namespace Tmpl8 {
 		bool flashRed{ false };
 		/* True when collided with the golden coal*/
 		bool collisionWithGoldCoal{ false };
-		float immuneSwitchTimer{ 0.0f };
 		/* Time between the player flashing red/gold and being invisible */
 		const float maxTimeBetweenImmuneSwitch{ 0.375f };
+		/* Calls back with the flashRed state to switch to, advanced while the player is drawn immune */
+		TimingWheel<bool> immuneSwitchTimer{ 1.0f / 120.0f };
 		unsigned int hitColor{ 0xfd5f44 };
 		unsigned int goldColor{ 0xedcd72 };
 
@@ -73,7 +78,8 @@ namespace Tmpl8 {
 		vec2 movePos{ 0.0f, 0.0f };
 		/* Holds the previous' frames' positions */
 		std::array<vec2, 12> previousPos;
-		inline static unsigned int frame{ 0 };
+		/* The frame the player was last drawn with, new flames are shot in its direction */
+		inline static unsigned int aimFrame{ 0 };
 
 		/* boost mechanic variables */
 		bool boost{ false };
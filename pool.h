@@ -0,0 +1,210 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Tmpl8 {
+
+	/* Refers to an item in a Pool, stays valid while the item is alive */
+	/* Once the item is removed the handle no longer resolves, even if the slot is reused */
+	struct PoolHandle
+	{
+		static constexpr uint32_t INVALID{ UINT32_MAX };
+
+		[[nodiscard]] bool IsValid() const { return slot != INVALID; }
+
+		uint32_t slot{ INVALID };
+		uint32_t generation{ 0 };
+	};
+
+	/* Container for entities, the memory for capacity items is allocated on construction and never grows */
+	/* Items are stored contiguously. RemoveAt() and Remove() move the last item into the gap, which is O(1) */
+	/* RemoveIf() and RemoveFlagged() keep the order of the other items, so the per-tick clean-ups leave */
+	/* the entities updated, collided and drawn in the same order as when they were in a vector */
+	template <typename T>
+	class Pool
+	{
+	public:
+		explicit Pool( size_t capacity );
+
+		/* Constructs an item at the end, returns an invalid handle and creates nothing when the pool is full */
+		template <typename... Args>
+		PoolHandle Emplace( Args&&... args );
+		/* Removes the item at index, the last item moves into its place */
+		void RemoveAt( size_t index );
+		/* Returns false when the handle no longer refers to an item */
+		bool Remove( PoolHandle handle );
+		/* Removes every item for which remove( item ) is true, in one pass that keeps the order */
+		template <typename Predicate>
+		void RemoveIf( Predicate remove );
+		/* Removes every item for which removed[index] is true, in one pass that keeps the order */
+		void RemoveFlagged( const std::vector<bool>& removed );
+		/* Removes every item, handles to them are invalidated */
+		void Clear();
+
+		/* Returns nullptr when the handle no longer refers to an item */
+		[[nodiscard]] T* Get( PoolHandle handle );
+		[[nodiscard]] const T* Get( PoolHandle handle ) const;
+		[[nodiscard]] PoolHandle GetHandle( size_t index ) const { return { itemSlot[index], slots[itemSlot[index]].generation }; }
+
+		[[nodiscard]] size_t Size() const { return items.size(); }
+		[[nodiscard]] size_t Capacity() const { return slots.size(); }
+		[[nodiscard]] bool Empty() const { return items.empty(); }
+		[[nodiscard]] bool Full() const { return items.size() == slots.size(); }
+
+		T& operator[]( size_t index ) { return items[index]; }
+		const T& operator[]( size_t index ) const { return items[index]; }
+		auto begin() { return items.begin(); }
+		auto end() { return items.end(); }
+		auto begin() const { return items.begin(); }
+		auto end() const { return items.end(); }
+
+	private:
+		/* Invalidates the handles to the item of slot and makes the slot available again */
+		void Release( uint32_t slot );
+		/* Removes every item for which removeAt( index ) is true, keeping the order of the others */
+		template <typename Predicate>
+		void Compact( Predicate removeAt );
+
+		struct Slot
+		{
+			/* Where the item of this slot is in items */
+			uint32_t index{ 0 };
+			/* Increased every time the slot's item is removed */
+			uint32_t generation{ 0 };
+		};
+
+		std::vector<T> items;
+		/* The slot of every item in items */
+		std::vector<uint32_t> itemSlot;
+		std::vector<Slot> slots;
+		/* Slots without an item, used as a stack */
+		std::vector<uint32_t> freeSlots;
+	};
+
+	template <typename T>
+	Pool<T>::Pool( size_t capacity )
+		: slots( capacity )
+	{
+		items.reserve( capacity );
+		itemSlot.reserve( capacity );
+		freeSlots.reserve( capacity );
+
+		/* Hand out the lowest slots first */
+		for (size_t i = capacity; i > 0; --i) { freeSlots.push_back( static_cast<uint32_t>(i - 1) ); }
+	}
+
+	template <typename T>
+	template <typename... Args>
+	PoolHandle Pool<T>::Emplace( Args&&... args )
+	{
+		if (freeSlots.empty()) { return {}; }
+
+		const uint32_t slot = freeSlots.back();
+		freeSlots.pop_back();
+
+		slots[slot].index = static_cast<uint32_t>(items.size());
+		items.emplace_back( std::forward<Args>( args )... );
+		itemSlot.push_back( slot );
+		return { slot, slots[slot].generation };
+	}
+
+	template <typename T>
+	void Pool<T>::RemoveAt( size_t index )
+	{
+		Release( itemSlot[index] );
+
+		const size_t last = items.size() - 1;
+		if (index != last)
+		{
+			items[index] = std::move( items[last] );
+			itemSlot[index] = itemSlot[last];
+			slots[itemSlot[index]].index = static_cast<uint32_t>(index);
+		}
+		items.pop_back();
+		itemSlot.pop_back();
+	}
+
+	template <typename T>
+	bool Pool<T>::Remove( PoolHandle handle )
+	{
+		if (!Get( handle )) { return false; }
+
+		RemoveAt( slots[handle.slot].index );
+		return true;
+	}
+
+	template <typename T>
+	template <typename Predicate>
+	void Pool<T>::RemoveIf( Predicate remove )
+	{
+		Compact( [this, &remove]( size_t index ) { return remove( items[index] ); } );
+	}
+
+	template <typename T>
+	void Pool<T>::RemoveFlagged( const std::vector<bool>& removed )
+	{
+		Compact( [&removed]( size_t index ) { return removed[index]; } );
+	}
+
+	template <typename T>
+	void Pool<T>::Clear()
+	{
+		for (const uint32_t slot : itemSlot) { Release( slot ); }
+		items.clear();
+		itemSlot.clear();
+	}
+
+	template <typename T>
+	void Pool<T>::Release( uint32_t slot )
+	{
+		slots[slot].generation++;
+		freeSlots.push_back( slot );
+	}
+
+	template <typename T>
+	template <typename Predicate>
+	void Pool<T>::Compact( Predicate removeAt )
+	{
+		/* Every kept item moves down at most once, an item is checked before anything moves into its place */
+		size_t kept = 0;
+		for (size_t i = 0; i < items.size(); ++i)
+		{
+			if (removeAt( i ))
+			{
+				Release( itemSlot[i] );
+				continue;
+			}
+
+			if (kept != i)
+			{
+				items[kept] = std::move( items[i] );
+				itemSlot[kept] = itemSlot[i];
+			}
+			slots[itemSlot[kept]].index = static_cast<uint32_t>(kept);
+			++kept;
+		}
+
+		items.erase( items.begin() + static_cast<std::ptrdiff_t>(kept), items.end() );
+		itemSlot.erase( itemSlot.begin() + static_cast<std::ptrdiff_t>(kept), itemSlot.end() );
+	}
+
+	template <typename T>
+	T* Pool<T>::Get( PoolHandle handle )
+	{
+		return const_cast<T*>(static_cast<const Pool&>(*this).Get( handle ));
+	}
+
+	template <typename T>
+	const T* Pool<T>::Get( PoolHandle handle ) const
+	{
+		if (handle.slot >= slots.size() || slots[handle.slot].generation != handle.generation) { return nullptr; }
+
+		/* Free slots aren't in itemSlot, so a handle to one doesn't resolve either */
+		const uint32_t index = slots[handle.slot].index;
+		if (index >= items.size() || itemSlot[index] != handle.slot) { return nullptr; }
+		return &items[index];
+	}
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#include "sequence.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace Tmpl8 {
+
+	Sequence::Sequence( Sequence&& other ) noexcept
+		: handle( std::exchange( other.handle, nullptr ) )
+	{}
+
+	Sequence& Sequence::operator=( Sequence&& other ) noexcept
+	{
+		if (this != &other)
+		{
+			if (handle) { handle.destroy(); }
+			handle = std::exchange( other.handle, nullptr );
+		}
+		return *this;
+	}
+
+	Sequence::~Sequence()
+	{
+		if (handle) { handle.destroy(); }
+	}
+
+	void Seconds::await_suspend( std::coroutine_handle<Sequence::promise_type> handle ) const
+	{
+		handle.promise().runner->timers.Schedule( seconds, handle );
+	}
+
+	void Until::await_suspend( std::coroutine_handle<Sequence::promise_type> handle )
+	{
+		handle.promise().runner->waiters.push_back( { handle, std::move( predicate ) } );
+	}
+
+	SequenceRunner::SequenceRunner( float tickLength )
+		: timers( tickLength )
+	{}
+
+	void SequenceRunner::Start( Sequence sequence )
+	{
+		if (sequence.IsDone()) { return; }
+
+		sequence.handle.promise().runner = this;
+		const std::coroutine_handle<> handle = sequence.handle;
+		running.push_back( std::move( sequence ) );
+
+		handle.resume();
+		RemoveDone();
+	}
+
+	void SequenceRunner::Update( float deltaTime )
+	{
+		/* Waiters added while checking were already checked this update by Until::await_ready() */
+		checking.swap( waiters );
+		for (Waiter& waiter : checking)
+		{
+			if (waiter.predicate()) { waiter.handle.resume(); }
+			else { waiters.push_back( std::move( waiter ) ); }
+		}
+		checking.clear();
+
+		timers.Advance( deltaTime, []( std::coroutine_handle<> handle ) { handle.resume(); } );
+
+		RemoveDone();
+	}
+
+	void SequenceRunner::Clear()
+	{
+		/* The timers and waiters refer to the sequences, forget them before destroying the sequences */
+		timers.Clear();
+		waiters.clear();
+		running.clear();
+	}
+
+	void SequenceRunner::RemoveDone()
+	{
+		running.erase( std::remove_if( running.begin(), running.end(),
+			[]( const Sequence& sequence ) { return sequence.IsDone(); } ), running.end() );
+	}
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <coroutine>
+#include <functional>
+#include <vector>
+
+#include "timingWheel.h"
+
+namespace Tmpl8 {
+
+	class SequenceRunner;
+
+	/* A scripted series of steps, written as a coroutine that co_awaits Seconds() and Until() */
+	/* Does nothing until it is given to a SequenceRunner, which owns and resumes it */
+	class Sequence
+	{
+	public:
+		struct promise_type
+		{
+			Sequence get_return_object() { return Sequence{ std::coroutine_handle<promise_type>::from_promise( *this ) }; }
+			/* The runner starts the sequence, so it is known before the first co_await */
+			std::suspend_always initial_suspend() noexcept { return {}; }
+			/* Stays suspended at the end, so the runner can see it is done before destroying it */
+			std::suspend_always final_suspend() noexcept { return {}; }
+			void return_void() {}
+			void unhandled_exception() { throw; }
+
+			SequenceRunner* runner{ nullptr };
+		};
+
+		Sequence( Sequence&& other ) noexcept;
+		Sequence& operator=( Sequence&& other ) noexcept;
+		Sequence( const Sequence& ) = delete;
+		Sequence& operator=( const Sequence& ) = delete;
+		~Sequence();
+
+		[[nodiscard]] bool IsDone() const { return !handle || handle.done(); }
+
+	private:
+		friend class SequenceRunner;
+
+		explicit Sequence( std::coroutine_handle<promise_type> _handle ) : handle( _handle ) {}
+
+		std::coroutine_handle<promise_type> handle;
+	};
+
+	/* co_await Seconds( x ) resumes the sequence once x seconds of the runner's updates have passed */
+	struct Seconds
+	{
+		explicit Seconds( float _seconds ) : seconds( _seconds ) {}
+
+		[[nodiscard]] bool await_ready() const { return seconds <= 0.0f; }
+		void await_suspend( std::coroutine_handle<Sequence::promise_type> handle ) const;
+		void await_resume() const {}
+
+		float seconds{ 0.0f };
+	};
+
+	/* co_await Until( predicate ) resumes the sequence in the first update in which predicate() is true */
+	/* predicate() is called right away and then once per update, so it may do the work it waits on */
+	struct Until
+	{
+		explicit Until( std::function<bool()> _predicate ) : predicate( std::move( _predicate ) ) {}
+
+		[[nodiscard]] bool await_ready() const { return predicate(); }
+		void await_suspend( std::coroutine_handle<Sequence::promise_type> handle );
+		void await_resume() const {}
+
+		std::function<bool()> predicate;
+	};
+
+	/* Owns the running sequences and resumes them, a waiting sequence costs nothing until its timer expires */
+	/* (Until() predicates are the exception, they are checked every update) */
+	class SequenceRunner
+	{
+	public:
+		explicit SequenceRunner( float tickLength );
+
+		/* Runs the sequence up to its first co_await */
+		void Start( Sequence sequence );
+		/* Resumes the sequences whose Until() predicate is true, then those whose Seconds() are over */
+		void Update( float deltaTime );
+		/* Stops every sequence where it is */
+		void Clear();
+
+		[[nodiscard]] bool Empty() const { return running.empty(); }
+
+	private:
+		friend struct Seconds;
+		friend struct Until;
+
+		struct Waiter
+		{
+			std::coroutine_handle<> handle;
+			std::function<bool()> predicate;
+		};
+
+		/* Destroys the sequences that finished */
+		void RemoveDone();
+
+		std::vector<Sequence> running;
+		TimingWheel<std::coroutine_handle<>> timers;
+		std::vector<Waiter> waiters;
+		/* The waiters being checked, so sequences can wait again while they are gone over */
+		std::vector<Waiter> checking;
+	};
+}
\ No newline at end of file
@@ -1,9 +1,14 @@
 #include "sfx.h"
 
-SFX::SFX( std::shared_ptr<Tmpl8::Sprite> sprite )
-	: volume_sprite( std::move( sprite ) )
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+
+SFX::SFX()
 {
+	Audio::Device::setPeriods( periodMilliseconds, periodCount );
 	Audio::Device::setMasterVolume( volume );
+	Audio::Device::setMaxVoices( maxVoices );
 	min_x = border_x + 10;
 	max_x = border_x + border_w - 11;
 	volumeBar_y = border_y + 10;
@@ -12,6 +17,138 @@ SFX::SFX( std::shared_ptr<Tmpl8::Sprite> sprite )
 	oldSelected_x = (max_x - min_x) / 2 + min_x;
 }
 
+void SFX::Load( Tmpl8::AssetManager& assets )
+{
+	using Tmpl8::AssetGroup;
+
+	assets.LoadSprite( volume_sprite, "assets/volume.png", 4, AssetGroup::MENU );
+
+	// Sounds that are often started in quick succession get more voices
+	LoadSound( assets, Effect::EXPLOSION, "assets/explosion.wav", 4, 0.4f, AssetGroup::MENU );
+	LoadSound( assets, Effect::BUTTON, "assets/button.wav", 1, 0.2f, AssetGroup::MENU );
+	LoadSound( assets, Effect::FLASH, "assets/flash.wav", 1, 0.8f, AssetGroup::MENU );
+	LoadSound( assets, Effect::GOLD, "assets/gold.wav", 1, 1.0f, AssetGroup::GAME );
+	LoadSound( assets, Effect::HURT, "assets/hurt.wav", 1, 1.0f, AssetGroup::GAME );
+	LoadSound( assets, Effect::HIT_COAL, "assets/hitCoal.wav", 4, 0.4f, AssetGroup::GAME );
+
+	// The simple effects are generated instead of loaded: type, start and end frequency (Hz), attack, hold and decay (seconds),
+	// noise, volume, and the number of variations and how much their pitch differs
+	// Sounds that play often get a few variations, so repeated hits don't all sound the same
+	using Audio::Waveform;
+	const Audio::SynthPreset shoot{ Waveform::Type::Square, 650.0f, 200.0f, 0.0f, 0.0f, 0.18f, 0.0f, 0.7f, 4, 0.05f };
+	const Audio::SynthPreset bounce{ Waveform::Type::Sine, 350.0f, 450.0f, 0.0f, 0.1f, 0.25f, 0.0f, 0.37f, 4, 0.08f };
+	const Audio::SynthPreset contact{ Waveform::Type::Triangle, 700.0f, 50.0f, 0.0f, 0.0f, 0.1f, 0.0f, 0.43f, 2, 0.1f };
+	const Audio::SynthPreset dash{ Waveform::Type::Square, 600.0f, 1750.0f, 0.04f, 0.09f, 0.08f, 0.0f, 0.28f };
+	GenerateSound( assets, Effect::SHOOT, shoot, 4, 0.4f, AssetGroup::GAME );
+	GenerateSound( assets, Effect::BOUNCE, bounce, 4, 0.2f, AssetGroup::GAME );
+	GenerateSound( assets, Effect::CONTACT, contact, 2, 1.0f, AssetGroup::GAME );
+	GenerateSound( assets, Effect::DASH, dash, 2, 0.4f, AssetGroup::GAME );
+
+	OpenMusic( menuMusic, "assets/menuMusic.ogg", 0.5f );
+	OpenMusic( gameMusic, "assets/gameMusic.ogg", 0.5f );
+}
+
+void SFX::OpenMusic( Audio::Music& music, const char* file, float musicVolume )
+{
+	if (!std::filesystem::exists( file )) { return; }
+
+	// Only the header and the first part of the track are decoded here, the rest while it plays
+	music = Audio::Device::openMusic( file );
+	music.setVolume( musicVolume );
+}
+
+Audio::Music* SFX::GetMusic( Track track )
+{
+	switch (track)
+	{
+	case Track::MENU:
+		return menuMusic ? &menuMusic : nullptr;
+	case Track::GAME:
+		return gameMusic ? &gameMusic : nullptr;
+	default:
+		return nullptr;
+	}
+}
+
+void SFX::SetMusic( Track track )
+{
+	if (track == currentTrack) { return; }
+
+	if (Audio::Music* current = GetMusic( currentTrack )) { current->fadeOut( musicFadeMilliseconds ); }
+	if (Audio::Music* next = GetMusic( track )) { next->fadeIn( musicFadeMilliseconds ); }
+	currentTrack = track;
+}
+
+void SFX::LoadSound( Tmpl8::AssetManager& assets, Effect effect, const char* file, unsigned int voiceCount,
+					float soundVolume, Tmpl8::AssetGroup group )
+{
+	assets.LoadSound( GetSound( effect ), file, voiceCount, GetPriority( effect ), soundVolume, group );
+}
+
+void SFX::GenerateSound( Tmpl8::AssetManager& assets, Effect effect, const Audio::SynthPreset& preset, unsigned int voiceCount,
+						 float soundVolume, Tmpl8::AssetGroup group )
+{
+	assets.GenerateSound( GetSound( effect ), preset, voiceCount, GetPriority( effect ), soundVolume, group );
+}
+
+int SFX::GetPriority( Effect effect )
+{
+	// Effects are declared with the highest priority first
+	return static_cast<int>(Effect::COUNT) - static_cast<int>(effect);
+}
+
+void SFX::Play( Effect effect )
+{
+	queued[static_cast<size_t>(effect)].fetch_add( 1, std::memory_order_relaxed );
+}
+
+void SFX::Flush()
+{
+	// The effects are declared in order of priority
+	unsigned int started = 0;
+	for (size_t i = 0; i < queued.size(); ++i)
+	{
+		// Sounds that don't make the cut this frame are dropped, not delayed
+		const unsigned int requests = queued[i].exchange( 0, std::memory_order_relaxed );
+		if (requests == 0 || started >= maxSoundsPerFrame) { continue; }
+
+		// Relative to the volume the sound was loaded with
+		const float boost = std::min( 1.0f + volumeBoostPerRequest * static_cast<float>(requests - 1), maxVolumeBoost );
+		if (sounds[i] && sounds[i].play( boost )) { ++started; }
+	}
+}
+
+int SFX::RunMixBenchmark( unsigned int voiceCount, const char* wavFile )
+{
+	Audio::Device::setHeadless();
+
+	const Audio::Device::MixBenchmark nodeGraph = Audio::Device::benchmarkMix( "assets/explosion.wav", voiceCount, benchmarkSeconds,
+																				 Audio::Device::MixPath::NodeGraph );
+	if (wavFile && !Audio::Device::setWavOutput( wavFile )) { return 1; }
+	const Audio::Device::MixBenchmark mixer = Audio::Device::benchmarkMix( "assets/explosion.wav", voiceCount, benchmarkSeconds,
+																			 Audio::Device::MixPath::Mixer );
+	Audio::Device::setWavOutput( {} );
+	if (nodeGraph.voiceCount == 0 || mixer.voiceCount == 0) { return 1; }
+
+	printf( "node graph: mixed %.1f s of %u voices in %.3f s, %.3f ms per mixed second\n", nodeGraph.mixedSeconds, nodeGraph.voiceCount,
+			nodeGraph.mixTime, nodeGraph.getTimePerMixedSecond() * 1000.0 );
+	printf( "mixer:      mixed %.1f s of %u voices in %.3f s, %.3f ms per mixed second\n", mixer.mixedSeconds, mixer.voiceCount,
+			mixer.mixTime, mixer.getTimePerMixedSecond() * 1000.0 );
+	return 0;
+}
+
+int SFX::RunLatencyTest( unsigned int eventCount )
+{
+	Audio::Device::setPeriods( periodMilliseconds, periodCount );
+
+	const Audio::Device::LatencyMeasurement result = Audio::Device::measureLatency( eventCount );
+	if (result.eventCount == 0) { return 1; }
+
+	printf( "output latency %.1f ms, event to audio %.1f ms average, %.1f ms max over %u events\n", result.outputLatency * 1000.0,
+			result.averageLatency * 1000.0, result.maximumLatency * 1000.0, result.eventCount );
+	return 0;
+}
+
 void SFX::UpdateVolumeBar(int mouse_x, int mouse_y, bool mouseHeldDown)
 {
 	// If the cursor clicks on the volume button
@@ -89,30 +226,31 @@ void SFX::DrawVolumeBar(Tmpl8::Surface* screen) const
 					border_y + border_h - 1,
 					0xffffff );
 
-	// Set the correct frame
+	// Pick the correct frame
+	unsigned int frame;
 	if (selected_x == min_x)
 	{
-		volume_sprite->SetFrame( 3 );
+		frame = 3;
 	}
 	else
 	{
 		const float temp_volume = static_cast<float>(selected_x - min_x) / static_cast<float>(max_x - min_x);
 		if (temp_volume <= 0.333f)
 		{
-			volume_sprite->SetFrame( 0 );
+			frame = 0;
 		}
 		else if (temp_volume <= 0.75f)
 		{
-			volume_sprite->SetFrame( 1 );
+			frame = 1;
 		}
 		else
 		{
-			volume_sprite->SetFrame( 2 );
+			frame = 2;
 		}
 	}
 
 	// Draw the speaker icon
-	volume_sprite->Draw( screen, border_x + border_w + 9, border_y );
+	volume_sprite->Draw( screen, border_x + border_w + 9, border_y, frame );
 }
 
 inline bool SFX::CursorOnVolumeBar( int mouse_x, int mouse_y ) const
@@ -153,5 +291,5 @@ void SFX::SetVolume()
 
 	Audio::Device::setMasterVolume( volume );
 	if (volume > 0.0f) { soundOff = false; }
-	explosion.replay();
+	Play( Effect::EXPLOSION );
 }
\ No newline at end of file
@@ -1,19 +1,45 @@
 #pragma once
 
 #include "surface.h"
+#include "assetManager.h"
 
+#include <array>
+#include <atomic>
 #include <memory>
 
 // Using an Audio library from Jeremiah van Oosten: https://github.com/jpvanoosten/Audio
-#include <Audio/Sound.hpp>
+#include <Audio/Music.hpp>
+#include <Audio/VoicePool.hpp>
 #include <Audio/Device.hpp>
 
 // Class for holding sound effects, also has a volume bar to modify the volume
+// Sounds are requested with Play() and only started once per frame by Flush()
+// Every sound has a few voices, so a sound that is started again doesn't cut itself off
 class SFX
 {
 public:
-	// Constructor - set the default master volume 
-	SFX( std::shared_ptr<Tmpl8::Sprite> sprite );
+	// The sound effects, in order of priority (highest first)
+	enum class Effect
+	{
+		HURT, // Plays when the player is hurt
+		GOLD, // Plays when the player collides with the golden coal
+		FLASH, // Plays when entering the secret mode
+		CONTACT, // Plays when the player collides with a basic coal while immune
+		BUTTON, // Plays when clicking on any button
+		EXPLOSION, // Plays when an explosion occurs
+		DASH, // Plays when the player uses the "dash" mechanic
+		SHOOT, // Plays when the player shoots a flame
+		HIT_COAL, // Plays when a flame hits a basic coal
+		BOUNCE, // Plays when a fireball bounces against a wall
+		COUNT
+	};
+
+	// Constructor - set the default master volume and the voice limit
+	SFX();
+
+	// Queues the sounds and the volume bar's sprite to be loaded
+	// Everything the main menu uses is part of the MENU group
+	void Load( Tmpl8::AssetManager& assets );
 
 	// Returns true if the volume bar is being "held down" on with the cursor
 	void UpdateVolumeBar(int mouse_x, int mouse_y, bool mouseHeldDown);
@@ -27,28 +53,69 @@ public:
 
 	[[nodiscard]] bool CurrentlyModifyingVolume() const { return modifyingVolume; }
 
-	// Plays when an explosion occurs
-	Audio::Sound explosion{ "assets/explosion.wav", Audio::Sound::Type::Sound };
-	// Plays when clicking on any button
-	Audio::Sound button{ "assets/button.wav", Audio::Sound::Type::Sound };
-	// Plays when the player shoots a flame
-	Audio::Sound shoot{ "assets/shoot.wav", Audio::Sound::Type::Sound };
-	// Plays when entering the secret mode
-	Audio::Sound flash{ "assets/flash.wav", Audio::Sound::Type::Sound };
-	// Plays when the player collides with the golden coal
-	Audio::Sound gold{ "assets/gold.wav", Audio::Sound::Type::Sound };
-	// Plays when a fireball bounces against a wall
-	Audio::Sound bounce{ "assets/bounce.wav", Audio::Sound::Type::Sound };
-	// Plays when the player is hurt
-	Audio::Sound hurt{ "assets/hurt.wav", Audio::Sound::Type::Sound };
-	// Plays when the player collides with a basic coal while immune
-	Audio::Sound contact{ "assets/contact.wav", Audio::Sound::Type::Sound };
-	// Plays when a flame hits a basic coal
-	Audio::Sound hitCoal{ "assets/hitCoal.wav", Audio::Sound::Type::Sound };
-	// Plays when the player uses the "dash" mechanic
-	Audio::Sound dash{ "assets/dash.wav", Audio::Sound::Type::Sound };
+	// Queues the sound for this frame, cheap enough to call from inside the collision loops
+	// Safe to call from any thread
+	void Play( Effect effect );
+	// Starts the sounds queued since the last call, call once per frame from the main thread
+	// A sound queued several times is started once, but louder, and only the...
+	// maxSoundsPerFrame sounds with the highest priority are started
+	void Flush();
+
+	// The background music, the menus and game play each have their own track
+	enum class Track
+	{
+		NONE,
+		MENU,
+		GAME
+	};
+
+	// Crossfades from the current track to this one, does nothing if it is already the current track
+	void SetMusic( Track track );
+
+	// Mixes benchmarkSeconds of voiceCount explosions without an audio device and prints how long it took,
+	// once with the mixer the sound effects use and once with a sound per voice in the engine's node graph
+	// Writes the mixer's mix to wavFile when it isn't nullptr, returns the exit code for main()
+	// Must be called before anything else uses the audio device
+	static int RunMixBenchmark( unsigned int voiceCount, const char* wavFile );
+	// Plays through the sound card and prints the latency from eventCount game events to their sound
+	// Returns the exit code for main(), must be called before anything else uses the audio device
+	static int RunLatencyTest( unsigned int eventCount );
 
 private:
+	[[nodiscard]] Audio::VoicePool& GetSound( Effect effect ) { return sounds[static_cast<size_t>(effect)]; }
+	void LoadSound( Tmpl8::AssetManager& assets, Effect effect, const char* file, unsigned int voiceCount,
+					float soundVolume, Tmpl8::AssetGroup group );
+	void GenerateSound( Tmpl8::AssetManager& assets, Effect effect, const Audio::SynthPreset& preset, unsigned int voiceCount,
+						float soundVolume, Tmpl8::AssetGroup group );
+	[[nodiscard]] static int GetPriority( Effect effect );
+	// The music is optional, a track that isn't there is skipped
+	static void OpenMusic( Audio::Music& music, const char* file, float musicVolume );
+	// Returns nullptr for Track::NONE and for tracks that weren't found
+	[[nodiscard]] Audio::Music* GetMusic( Track track );
+
+	std::array<Audio::VoicePool, static_cast<size_t>(Effect::COUNT)> sounds;
+	// How often each sound was queued since the last Flush()
+	std::array<std::atomic<unsigned int>, static_cast<size_t>(Effect::COUNT)> queued{};
+
+	static constexpr unsigned int maxSoundsPerFrame{ 4 };
+	// The most voices of all sounds together that play at once, the oldest voice of the...
+	// sound with the lowest priority is stopped to make room
+	static constexpr unsigned int maxVoices{ 16 };
+	// Every extra request in the same frame adds this much to the volume, up to maxVolumeBoost
+	static constexpr float volumeBoostPerRequest{ 0.25f };
+	static constexpr float maxVolumeBoost{ 1.5f };
+	static constexpr double benchmarkSeconds{ 10.0 };
+	// The sound card's buffer holds periodCount periods of periodMilliseconds, a sound can only be heard
+	// after the periods that are already in it, too little and the audio stutters when the mixer falls behind
+	static constexpr unsigned int periodMilliseconds{ 10 };
+	static constexpr unsigned int periodCount{ 2 };
+
+	// The music is streamed from its file while it plays
+	Audio::Music menuMusic;
+	Audio::Music gameMusic;
+	Track currentTrack{ Track::NONE };
+	static constexpr unsigned int musicFadeMilliseconds{ 1500 };
+
 	std::shared_ptr<Tmpl8::Sprite> volume_sprite;
 
 	// 0.0f - 1.0f
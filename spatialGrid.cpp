@@ -0,0 +1,56 @@
+#include "spatialGrid.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Tmpl8 {
+
+	SpatialGrid::SpatialGrid( vec2 _min, vec2 _max, float cellSize )
+		: min( _min )
+		, invCellSize( 1.0f / cellSize )
+	{
+		columns = Max( static_cast<int>(ceilf( (_max.x - _min.x) / cellSize )), 1 );
+		rows = Max( static_cast<int>(ceilf( (_max.y - _min.y) / cellSize )), 1 );
+		cellStart.assign( static_cast<size_t>(columns * rows) + 1, 0 );
+	}
+
+	void SpatialGrid::Clear()
+	{
+		positions.clear();
+		cellOf.clear();
+		maxRadius = 0.0f;
+	}
+
+	void SpatialGrid::Insert( Circle circle )
+	{
+		positions.push_back( circle.pos );
+		cellOf.push_back( static_cast<unsigned int>(CellY( circle.pos.y ) * columns + CellX( circle.pos.x )) );
+		maxRadius = Max( maxRadius, circle.r );
+	}
+
+	void SpatialGrid::Build()
+	{
+		/* Counting sort, so the circles within a cell stay in insertion order */
+		std::fill( cellStart.begin(), cellStart.end(), 0 );
+		for (const unsigned int cell : cellOf) { cellStart[cell + 1]++; }
+		for (size_t c = 1; c < cellStart.size(); ++c) { cellStart[c] += cellStart[c - 1]; }
+
+		sorted.resize( cellOf.size() );
+		cellCursor.assign( cellStart.begin(), cellStart.end() - 1 );
+		for (unsigned int i = 0; i < cellOf.size(); ++i)
+		{
+			sorted[cellCursor[cellOf[i]]++] = i;
+		}
+	}
+
+	int SpatialGrid::CellX( float x ) const
+	{
+		/* Clamp before casting, positions far outside of the grid could overflow an int */
+		return static_cast<int>(Clamp( floorf( (x - min.x) * invCellSize ), 0.0f, static_cast<float>(columns - 1) ));
+	}
+
+	int SpatialGrid::CellY( float y ) const
+	{
+		return static_cast<int>(Clamp( floorf( (y - min.y) * invCellSize ), 0.0f, static_cast<float>(rows - 1) ));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "entity.h"
+#include "template.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace Tmpl8 {
+
+	/* Uniform grid used to only test entities that are close to each other */
+	/* Circles are inserted in order, their insertion index is what queries return */
+	/* Positions outside of the grid's bounds are put in the nearest border cell */
+	class SpatialGrid
+	{
+	public:
+		/* Index that no circle has, used to report that nothing matched */
+		static constexpr size_t NONE{ SIZE_MAX };
+
+		SpatialGrid( vec2 min, vec2 max, float cellSize );
+
+		/* Removes every circle, the cells keep their memory */
+		void Clear();
+		void Insert( Circle circle );
+		/* Sorts the inserted circles into their cells, call before querying */
+		void Build();
+
+		/* Calls visit( index ) for every circle in a cell that the given circle could overlap with */
+		/* The exact overlap test is up to the caller */
+		template <typename Visit>
+		void Query( Circle circle, Visit visit ) const;
+
+		[[nodiscard]] size_t Size() const { return positions.size(); }
+
+	private:
+		[[nodiscard]] int CellX( float x ) const;
+		[[nodiscard]] int CellY( float y ) const;
+
+		vec2 min;
+		float invCellSize{ 0.0f };
+		int columns{ 1 };
+		int rows{ 1 };
+		/* Largest radius inserted since the last Clear(), queries are widened by it */
+		float maxRadius{ 0.0f };
+
+		std::vector<vec2> positions;
+		std::vector<unsigned int> cellOf;
+		/* The circles in cell c are sorted[cellStart[c]] up to sorted[cellStart[c + 1]] */
+		std::vector<unsigned int> cellStart;
+		std::vector<unsigned int> sorted;
+		/* Where the next circle of each cell is placed during Build() */
+		std::vector<unsigned int> cellCursor;
+	};
+
+	template <typename Visit>
+	void SpatialGrid::Query( Circle circle, Visit visit ) const
+	{
+		const float reach = circle.r + maxRadius;
+		const int x0 = CellX( circle.pos.x - reach );
+		const int x1 = CellX( circle.pos.x + reach );
+		const int y0 = CellY( circle.pos.y - reach );
+		const int y1 = CellY( circle.pos.y + reach );
+
+		for (int y = y0; y <= y1; ++y)
+		{
+			for (int x = x0; x <= x1; ++x)
+			{
+				const int cell = y * columns + x;
+				for (unsigned int i = cellStart[cell]; i < cellStart[cell + 1]; ++i)
+				{
+					visit( static_cast<size_t>(sorted[i]) );
+				}
+			}
+		}
+	}
+}
\ No newline at end of file
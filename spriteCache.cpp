@@ -0,0 +1,103 @@
+#include "spriteCache.h"
+
+namespace Tmpl8 {
+
+	SpriteCache::SpriteCache( AssetManager& _assets, size_t budgetBytes )
+		: assets( _assets )
+		, budget( budgetBytes )
+	{}
+
+	SpriteHandle SpriteCache::Register( const char* file, unsigned int frames, AssetGroup group )
+	{
+		Entry entry;
+		entry.file = file;
+		entry.frames = frames;
+		entry.group = group;
+		entries.push_back( std::move( entry ) );
+
+		return static_cast<SpriteHandle>(entries.size() - 1);
+	}
+
+	void SpriteCache::Prefetch( SpriteHandle handle )
+	{
+		Entry& entry = entries[handle];
+		if (entry.sprite || entry.loading.valid()) { return; }
+
+		entry.loading = assets.LoadSprite( entry.sprite, entry.file.c_str(), entry.frames, entry.group );
+	}
+
+	std::shared_ptr<Sprite> SpriteCache::Get( SpriteHandle handle )
+	{
+		Entry& entry = entries[handle];
+		if (!entry.sprite)
+		{
+			Prefetch( handle );
+			entry.loading.wait();
+			/* The sprite is decoded, but only set once the AssetManager publishes it */
+			assets.Update();
+			CollectLoaded();
+		}
+
+		entry.lastUsed = tick;
+		return entry.sprite;
+	}
+
+	void SpriteCache::Update()
+	{
+		CollectLoaded();
+		tick++;
+		/* Whatever was drawn last tick is likely drawn again, keep it resident */
+		Trim( budget, tick - 1 );
+	}
+
+	void SpriteCache::EvictIdle()
+	{
+		CollectLoaded();
+		Trim( 0, tick );
+	}
+
+	void SpriteCache::CollectLoaded()
+	{
+		for (auto& entry : entries)
+		{
+			if (entry.sprite && entry.loading.valid())
+			{
+				/* The future holds a reference to the sprite as well, release it */
+				entry.loading = {};
+
+				Surface* surface = entry.sprite->GetSurface();
+				entry.bytes = static_cast<size_t>(surface->GetPitch()) * static_cast<size_t>(surface->GetHeight()) * sizeof( Pixel );
+				residentBytes += entry.bytes;
+			}
+		}
+	}
+
+	void SpriteCache::Trim( size_t maxBytes, uint64_t usedBefore )
+	{
+		while (residentBytes > maxBytes)
+		{
+			/* Find the least recently used sprite that can be evicted */
+			Entry* oldest = nullptr;
+			for (auto& entry : entries)
+			{
+				if (IsEvictable( entry, usedBefore ) && (!oldest || entry.lastUsed < oldest->lastUsed))
+				{
+					oldest = &entry;
+				}
+			}
+			if (!oldest) { return; }
+
+			oldest->sprite.reset();
+			residentBytes -= oldest->bytes;
+			oldest->bytes = 0;
+		}
+	}
+
+	bool SpriteCache::IsEvictable( const Entry& entry, uint64_t usedBefore )
+	{
+		return	entry.sprite &&
+				!entry.loading.valid() &&
+				entry.sprite.use_count() == 1 &&
+				entry.lastUsed < usedBefore;
+	}
+}
\ No newline at end of file
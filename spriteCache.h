@@ -0,0 +1,74 @@
+#pragma once
+
+#include "assetManager.h"
+#include "surface.h"
+
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+#include <string>
+
+namespace Tmpl8 {
+
+	/* Refers to a sprite registered in a SpriteCache */
+	using SpriteHandle = unsigned int;
+
+	/* Holds large, rarely used sprites that are only loaded when needed */
+	/* Sprites that weren't used recently are unloaded once the cache is over its memory budget */
+	class SpriteCache
+	{
+	public:
+		SpriteCache( AssetManager& assets, size_t budgetBytes );
+
+		SpriteCache( const SpriteCache& ) = delete;
+		SpriteCache& operator=( const SpriteCache& ) = delete;
+
+		/* Nothing is loaded until the sprite is prefetched or requested */
+		SpriteHandle Register( const char* file, unsigned int frames, AssetGroup group );
+		/* Starts loading the sprite in the background if it isn't resident */
+		void Prefetch( SpriteHandle handle );
+		/* Returns the sprite, blocks until it is loaded if it isn't resident */
+		/* Must be called from the main thread */
+		std::shared_ptr<Sprite> Get( SpriteHandle handle );
+		/* Advances the cache's clock and evicts sprites until it's within its budget */
+		/* Called once per tick, after AssetManager::Update() */
+		void Update();
+		/* Evicts every sprite that isn't held elsewhere and wasn't used yet this tick */
+		void EvictIdle();
+
+		void SetBudget( size_t bytes ) { budget = bytes; }
+		[[nodiscard]] size_t GetBudget() const { return budget; }
+		[[nodiscard]] size_t GetResidentBytes() const { return residentBytes; }
+
+	private:
+		struct Entry
+		{
+			std::string file;
+			unsigned int frames{ 1 };
+			AssetGroup group{ AssetGroup::STREAMED };
+			/* Set by the AssetManager once loaded, reset when evicted */
+			std::shared_ptr<Sprite> sprite{ nullptr };
+			/* Valid while the sprite is being loaded */
+			std::shared_future<std::shared_ptr<Sprite>> loading;
+			size_t bytes{ 0 };
+			/* Tick at which the sprite was last returned by Get() */
+			uint64_t lastUsed{ 0 };
+		};
+
+		/* Accounts for sprites that finished loading since the last call */
+		void CollectLoaded();
+		/* Evicts least recently used sprites until at most maxBytes are resident */
+		/* Only sprites last used before the given tick are considered */
+		void Trim( size_t maxBytes, uint64_t usedBefore );
+		/* A sprite can only be evicted when nothing but the cache holds it */
+		[[nodiscard]] static bool IsEvictable( const Entry& entry, uint64_t usedBefore );
+
+		AssetManager& assets;
+		/* A deque, so the AssetManager can keep a reference to an entry's sprite while it loads */
+		std::deque<Entry> entries;
+		size_t budget{ 0 };
+		size_t residentBytes{ 0 };
+		uint64_t tick{ 1 };
+	};
+}
\ No newline at end of file
@@ -0,0 +1,30 @@
+#include "spriteRegistry.h"
+
+#include <cassert>
+
+namespace Tmpl8 {
+
+	SpriteId SpriteRegistry::Register( std::shared_ptr<Sprite> sprite )
+	{
+		assert( sprites.size() < NONE && "Too many sprites registered" );
+
+		sprites.push_back( std::move( sprite ) );
+		return static_cast<SpriteId>(sprites.size() - 1);
+	}
+
+	void SpriteRegistry::Set( SpriteId id, std::shared_ptr<Sprite> sprite )
+	{
+		sprites[id] = std::move( sprite );
+	}
+
+	Sprite* SpriteRegistry::Get( SpriteId id )
+	{
+		if (id >= sprites.size()) { return nullptr; }
+		return sprites[id].get();
+	}
+
+	void SpriteRegistry::Clear()
+	{
+		sprites.clear();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "surface.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Tmpl8 {
+
+	/* Refers to a sprite in the SpriteRegistry */
+	using SpriteId = uint16_t;
+
+	/* Owns the sprites that entities are drawn with */
+	/* Entities only store a SpriteId, so creating, moving and removing them */
+	/* doesn't touch a shared_ptr's reference count */
+	class SpriteRegistry
+	{
+	public:
+		/* An entity without a sprite */
+		static constexpr SpriteId NONE{ UINT16_MAX };
+
+		/* Adds a slot for a sprite, which can be empty until the sprite is loaded */
+		/* Must be called from the main thread, before anything is drawn with the returned id */
+		static SpriteId Register( std::shared_ptr<Sprite> sprite = nullptr );
+		/* Fills or replaces the sprite in a slot, must be called from the main thread */
+		static void Set( SpriteId id, std::shared_ptr<Sprite> sprite );
+		/* Returns nullptr for NONE or a slot that's still empty */
+		[[nodiscard]] static Sprite* Get( SpriteId id );
+		/* Releases every sprite, ids handed out before are no longer valid */
+		static void Clear();
+
+	private:
+		inline static std::vector<std::shared_ptr<Sprite>> sprites;
+	};
+}
\ No newline at end of file
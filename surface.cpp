@@ -369,7 +369,6 @@ Sprite::Sprite( Surface* a_Surface, unsigned int a_NumFrames ) :
 	m_Height( a_Surface->GetHeight() ),
 	m_Pitch(  a_Surface->GetWidth() ),
 	m_NumFrames( a_NumFrames ),
-	m_CurrentFrame( 0 ),
 	m_Flags( 0 ),
 	m_Start( new unsigned int*[a_NumFrames] ),
 	m_Surface( a_Surface )
@@ -384,13 +383,13 @@ Sprite::~Sprite()
 	delete[] m_Start;
 }
 
-void Sprite::Draw( Surface* a_Target, int a_X, int a_Y )
+void Sprite::Draw( Surface* a_Target, int a_X, int a_Y, unsigned int a_Frame ) const
 {
 	if ((a_X < -m_Width) || (a_X > (a_Target->GetWidth() + m_Width))) return;
 	if ((a_Y < -m_Height) || (a_Y > (a_Target->GetHeight() + m_Height))) return;
 	int x1 = a_X, x2 = a_X + m_Width;
 	int y1 = a_Y, y2 = a_Y + m_Height;
-	Pixel* src = GetBuffer() + m_CurrentFrame * m_Width;
+	Pixel* src = m_Surface->GetBuffer() + a_Frame * m_Width;
 	if (x1 < 0)
 	{
 		src += -x1;
@@ -414,8 +413,8 @@ void Sprite::Draw( Surface* a_Target, int a_X, int a_Y )
 		for ( int y = 0; y < height; y++ )
 		{
 			const int line = y + (y1 - a_Y);
-			if (m_CurrentFrame >= m_NumFrames) { break; }
-			const int lsx = static_cast<int>(m_Start[m_CurrentFrame][line]) + a_X;
+			if (a_Frame >= m_NumFrames) { break; }
+			const int lsx = static_cast<int>(m_Start[a_Frame][line]) + a_X;
 			if (m_Flags & FLARE)
 			{
 				xs = (lsx > x1)?lsx - x1:0;
@@ -444,15 +443,15 @@ void Sprite::Draw( Surface* a_Target, int a_X, int a_Y )
 	}
 }
 
-void Sprite::DrawBlend(	Surface* a_Target, int a_X, int a_Y, float alpha,
+void Sprite::DrawBlend(	Surface* a_Target, int a_X, int a_Y, unsigned int a_Frame, float alpha,
 						int shadow_max_x, int shadow_max_y, int fadeLength,
-						Pixel shadow_c, float shadow_alpha )
+						Pixel shadow_c, float shadow_alpha ) const
 {
 	if ((a_X < -m_Width) || (a_X > ( a_Target->GetWidth() + m_Width ))) return;
 	if ((a_Y < -m_Height) || (a_Y > ( a_Target->GetHeight() + m_Height ))) return;
 	int x1 = a_X, x2 = a_X + m_Width;
 	int y1 = a_Y, y2 = a_Y + m_Height;
-	Pixel* src = GetBuffer() + m_CurrentFrame * m_Width;
+	Pixel* src = m_Surface->GetBuffer() + a_Frame * m_Width;
 	if (x1 < 0)
 	{
 		src += -x1;
@@ -476,8 +475,8 @@ void Sprite::DrawBlend(	Surface* a_Target, int a_X, int a_Y, float alpha,
 		for (int y = 0; y < height; y++)
 		{
 			const int line = y + (y1 - a_Y);
-			if (m_CurrentFrame >= m_NumFrames) { break; }
-			const int lsx = static_cast<int>(m_Start[m_CurrentFrame][line]) + a_X;
+			if (a_Frame >= m_NumFrames) { break; }
+			const int lsx = static_cast<int>(m_Start[a_Frame][line]) + a_X;
 			xs = (lsx > x1) ? lsx - x1 : 0;
 			for (int x = xs; x < width; x++)
 			{
@@ -492,13 +491,13 @@ void Sprite::DrawBlend(	Surface* a_Target, int a_X, int a_Y, float alpha,
 	}
 }
 
-void Sprite::DrawInColor( Surface* a_Target, int a_X, int a_Y, Pixel color )
+void Sprite::DrawInColor( Surface* a_Target, int a_X, int a_Y, unsigned int a_Frame, Pixel color ) const
 {
 	if ((a_X < -m_Width) || (a_X > ( a_Target->GetWidth() + m_Width ))) return;
 	if ((a_Y < -m_Height) || (a_Y > ( a_Target->GetHeight() + m_Height ))) return;
 	int x1 = a_X, x2 = a_X + m_Width;
 	int y1 = a_Y, y2 = a_Y + m_Height;
-	Pixel* src = GetBuffer() + m_CurrentFrame * m_Width;
+	Pixel* src = m_Surface->GetBuffer() + a_Frame * m_Width;
 	if (x1 < 0)
 	{
 		src += -x1;
@@ -522,8 +521,8 @@ void Sprite::DrawInColor( Surface* a_Target, int a_X, int a_Y, Pixel color )
 		for (int y = 0; y < height; y++)
 		{
 			const int line = y + (y1 - a_Y);
-			if (m_CurrentFrame >= m_NumFrames) { break; }
-			const int lsx = static_cast<int>(m_Start[m_CurrentFrame][line]) + a_X;
+			if (a_Frame >= m_NumFrames) { break; }
+			const int lsx = static_cast<int>(m_Start[a_Frame][line]) + a_X;
 			
 			xs = (lsx > x1) ? lsx - x1 : 0;
 			for (int x = xs; x < width; x++)
@@ -538,15 +537,15 @@ void Sprite::DrawInColor( Surface* a_Target, int a_X, int a_Y, Pixel color )
 	}
 }
 
-void Sprite::DrawInColorAndBlend(	Surface* a_Target, int a_X, int a_Y, Pixel color, float alpha,
+void Sprite::DrawInColorAndBlend(	Surface* a_Target, int a_X, int a_Y, unsigned int a_Frame, Pixel color, float alpha,
 									int shadow_max_x, int shadow_max_y, int fadeLength, 
-									Pixel shadow_c, float shadow_alpha )
+									Pixel shadow_c, float shadow_alpha ) const
 {
 	if ((a_X < -m_Width) || (a_X > ( a_Target->GetWidth() + m_Width ))) return;
 	if ((a_Y < -m_Height) || (a_Y > ( a_Target->GetHeight() + m_Height ))) return;
 	int x1 = a_X, x2 = a_X + m_Width;
 	int y1 = a_Y, y2 = a_Y + m_Height;
-	Pixel* src = GetBuffer() + m_CurrentFrame * m_Width;
+	Pixel* src = m_Surface->GetBuffer() + a_Frame * m_Width;
 	if (x1 < 0)
 	{
 		src += -x1;
@@ -570,8 +569,8 @@ void Sprite::DrawInColorAndBlend(	Surface* a_Target, int a_X, int a_Y, Pixel col
 		for (int y = 0; y < height; y++)
 		{
 			const int line = y + (y1 - a_Y);
-			if (m_CurrentFrame >= m_NumFrames) { break; }
-			const int lsx = static_cast<int>(m_Start[m_CurrentFrame][line]) + a_X;
+			if (a_Frame >= m_NumFrames) { break; }
+			const int lsx = static_cast<int>(m_Start[a_Frame][line]) + a_X;
 
 			xs = (lsx > x1) ? lsx - x1 : 0;
 			for (int x = xs; x < width; x++)
@@ -588,15 +587,15 @@ void Sprite::DrawInColorAndBlend(	Surface* a_Target, int a_X, int a_Y, Pixel col
 	}
 }
 
-void Sprite::DrawInBlendedColor(	Surface* a_Target, int a_X, int a_Y, Pixel color, float alpha,
+void Sprite::DrawInBlendedColor(	Surface* a_Target, int a_X, int a_Y, unsigned int a_Frame, Pixel color, float alpha,
 									int shadow_max_x, int shadow_max_y, int fadeLength,
-									Pixel shadow_c, float shadow_alpha )
+									Pixel shadow_c, float shadow_alpha ) const
 {
 	if ((a_X < -m_Width) || (a_X > ( a_Target->GetWidth() + m_Width ))) return;
 	if ((a_Y < -m_Height) || (a_Y > ( a_Target->GetHeight() + m_Height ))) return;
 	int x1 = a_X, x2 = a_X + m_Width;
 	int y1 = a_Y, y2 = a_Y + m_Height;
-	Pixel* src = GetBuffer() + m_CurrentFrame * m_Width;
+	Pixel* src = m_Surface->GetBuffer() + a_Frame * m_Width;
 	if (x1 < 0)
 	{
 		src += -x1;
@@ -620,8 +619,8 @@ void Sprite::DrawInBlendedColor(	Surface* a_Target, int a_X, int a_Y, Pixel colo
 		for (int y = 0; y < height; y++)
 		{
 			const int line = y + (y1 - a_Y);
-			if (m_CurrentFrame >= m_NumFrames) { break; }
-			const int lsx = static_cast<int>(m_Start[m_CurrentFrame][line]) + a_X;
+			if (a_Frame >= m_NumFrames) { break; }
+			const int lsx = static_cast<int>(m_Start[a_Frame][line]) + a_X;
 
 			xs = (lsx > x1) ? lsx - x1 : 0;
 			for (int x = xs; x < width; x++)
@@ -638,7 +637,7 @@ void Sprite::DrawInBlendedColor(	Surface* a_Target, int a_X, int a_Y, Pixel colo
 	}
 }
 
-void Sprite::DrawWithShadow(Surface* a_Target, int a_X, int a_Y, int shadow_max_x, int shadow_max_y, int fadeLength, Pixel shadow_c, float alpha)
+void Sprite::DrawWithShadow(Surface* a_Target, int a_X, int a_Y, unsigned int a_Frame, int shadow_max_x, int shadow_max_y, int fadeLength, Pixel shadow_c, float alpha) const
 {
 	if ((a_X < -m_Width) || (a_X > ( a_Target->GetWidth() + m_Width ))) return;
 	if ((a_Y < -m_Height) || (a_Y > ( a_Target->GetHeight() + m_Height ))) return;
@@ -646,7 +645,7 @@ void Sprite::DrawWithShadow(Surface* a_Target, int a_X, int a_Y, int shadow_max_
 	int x2 = a_X + m_Width;
 	int y1 = a_Y;
 	int y2 = a_Y + m_Height;
-	Pixel* src = GetBuffer() + m_CurrentFrame * m_Width;
+	Pixel* src = m_Surface->GetBuffer() + a_Frame * m_Width;
 	if (x1 < 0)
 	{
 		src += -x1;
@@ -670,8 +669,8 @@ void Sprite::DrawWithShadow(Surface* a_Target, int a_X, int a_Y, int shadow_max_
 		for (int y = 0; y < height; y++)
 		{
 			const int line = y + (y1 - a_Y);
-			if (m_CurrentFrame >= m_NumFrames) { break; }
-			const int lsx = static_cast<int>(m_Start[m_CurrentFrame][line]) + a_X;
+			if (a_Frame >= m_NumFrames) { break; }
+			const int lsx = static_cast<int>(m_Start[a_Frame][line]) + a_X;
 			
 			xs = (lsx > x1) ? lsx - x1 : 0;
 			for (int x = xs; x < width; x++)
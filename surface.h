@@ -200,35 +200,36 @@ public:
 
 	~Sprite();
 	// Methods
-	void Draw( Surface* a_Target, int a_X, int a_Y );
+	// The frame to draw is passed in, drawing doesn't change the sprite
+	// so the same sprite can be drawn by many entities (and threads) at once
+	void Draw( Surface* a_Target, int a_X, int a_Y, unsigned int a_Frame ) const;
 	// Added a function to draw a sprite blend in with the background
 	// Can also add shadows
-	void DrawBlend( Surface* a_Target, int a_X, int a_Y, float alpha,
+	void DrawBlend( Surface* a_Target, int a_X, int a_Y, unsigned int a_Frame, float alpha,
 					int shadow_max_x = 0, int shadow_max_y = 0, int fadeLength = 0,
-					Pixel shadow_c = 0, float shadow_alpha = 0.0f );
+					Pixel shadow_c = 0, float shadow_alpha = 0.0f ) const;
 	// Added a function to draw a sprite as one specified color 
-	void DrawInColor( Surface* a_Target, int a_X, int a_Y, Pixel color );
+	void DrawInColor( Surface* a_Target, int a_X, int a_Y, unsigned int a_Frame, Pixel color ) const;
 	// Added a function to draw a sprite as one specified color and blend in with the background
 	// Can also add shadows
-	void DrawInColorAndBlend(	Surface* a_Target, int a_X, int a_Y, Pixel color, float alpha, 
+	void DrawInColorAndBlend(	Surface* a_Target, int a_X, int a_Y, unsigned int a_Frame, Pixel color, float alpha, 
 								int shadow_max_x = 0, int shadow_max_y = 0, int fadeLength = 0, 
-								Pixel shadow_c = 0, float shadow_alpha = 0.0f );
+								Pixel shadow_c = 0, float shadow_alpha = 0.0f ) const;
 	// Added a function to draw a sprite blended with a specified color
 	// Can also add shadows
-	void DrawInBlendedColor(	Surface* a_Target, int a_X, int a_Y, Pixel color, float alpha,
+	void DrawInBlendedColor(	Surface* a_Target, int a_X, int a_Y, unsigned int a_Frame, Pixel color, float alpha,
 								int shadow_max_x = 0, int shadow_max_y = 0, int fadeLength = 0,
-								Pixel shadow_c = 0, float shadow_alpha = 0.0f );
+								Pixel shadow_c = 0, float shadow_alpha = 0.0f ) const;
 	// Added a function to draw a sprite with shadow (assuming light is at the top left)
 	// Also has the option of "fading in" the shadow if fadeLength is set > 0
-	void DrawWithShadow( Surface* a_Target, int a_X, int a_Y, int shadow_max_x, int shadow_max_y, int fadeLength, Pixel shadow_c, float alpha );
+	void DrawWithShadow( Surface* a_Target, int a_X, int a_Y, unsigned int a_Frame, int shadow_max_x, int shadow_max_y, int fadeLength, Pixel shadow_c, float alpha ) const;
 	void DrawScaled( int a_X, int a_Y, int a_Width, int a_Height, Surface* a_Target );
 	void SetFlags( unsigned int a_Flags ) { m_Flags = a_Flags; }
-	void SetFrame( unsigned int a_Index ) { m_CurrentFrame = a_Index; }
 	unsigned int GetFlags() const { return m_Flags; }
-	int GetWidth() { return m_Width; }
-	int GetHeight() { return m_Height; }
+	int GetWidth() const { return m_Width; }
+	int GetHeight() const { return m_Height; }
 	Pixel* GetBuffer() { return m_Surface->GetBuffer(); }	
-	unsigned int Frames() { return m_NumFrames; }
+	unsigned int Frames() const { return m_NumFrames; }
 	Surface* GetSurface() { return m_Surface; }
 private:
 	// Methods
@@ -236,7 +237,6 @@ private:
 	// Attributes
 	int m_Width, m_Height, m_Pitch;
 	unsigned int m_NumFrames;          
-	unsigned int m_CurrentFrame;       
 	unsigned int m_Flags;
 	unsigned int** m_Start;
 	Surface* m_Surface;
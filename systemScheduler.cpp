@@ -0,0 +1,108 @@
+#include "systemScheduler.h"
+
+#include "jobSystem.h"
+
+#include <algorithm>
+
+namespace Tmpl8 {
+
+	SystemScheduler::SystemScheduler( JobSystem& _jobSystem )
+		: jobSystem( _jobSystem )
+	{}
+
+	void SystemScheduler::Add( ResourceSet reads, ResourceSet writes, std::function<void( float )> run )
+	{
+		systems.push_back( { reads, writes, std::move( run ) } );
+		dirty = true;
+	}
+
+	void SystemScheduler::Run( float deltaTime )
+	{
+		if (dirty) { BuildWaves(); }
+
+		std::vector<JobHandle> running;
+		for (const auto& wave : waves)
+		{
+			if (!WorthJobs( wave ))
+			{
+				for (const size_t index : wave) { RunTimed( systems[index], deltaTime ); }
+				continue;
+			}
+
+			/* The main thread runs the slowest system of the wave itself, instead of only waiting */
+			size_t slowest = wave.front();
+			for (const size_t index : wave)
+			{
+				if (systems[index].averageTime > systems[slowest].averageTime) { slowest = index; }
+			}
+
+			for (const size_t index : wave)
+			{
+				if (index == slowest) { continue; }
+
+				System& system = systems[index];
+				running.push_back( jobSystem.Submit( [&system, deltaTime] { RunTimed( system, deltaTime ); }, "system" ) );
+			}
+			RunTimed( systems[slowest], deltaTime );
+
+			for (const auto& job : running) { jobSystem.Wait( job ); }
+			running.clear();
+		}
+	}
+
+	void SystemScheduler::RunTimed( System& system, float deltaTime )
+	{
+		const auto start = std::chrono::steady_clock::now();
+		system.run( deltaTime );
+		const float time = std::chrono::duration<float>( std::chrono::steady_clock::now() - start ).count();
+
+		/* Smoothed, so a single slow tick doesn't move the systems onto jobs */
+		system.averageTime += (time - system.averageTime) * 0.05f;
+	}
+
+	bool SystemScheduler::WorthJobs( const std::vector<size_t>& wave ) const
+	{
+		if (wave.size() < 2 || jobSystem.GetWorkerCount() == 0) { return false; }
+
+		float total = 0.0f;
+		float slowest = 0.0f;
+		for (const size_t index : wave)
+		{
+			total += systems[index].averageTime;
+			slowest = std::max( slowest, systems[index].averageTime );
+		}
+		return total - slowest >= std::chrono::duration<float>( minParallelTime ).count();
+	}
+
+	size_t SystemScheduler::GetWaveCount()
+	{
+		if (dirty) { BuildWaves(); }
+		return waves.size();
+	}
+
+	void SystemScheduler::BuildWaves()
+	{
+		waves.clear();
+		std::vector<size_t> waveOf( systems.size(), 0 );
+
+		for (size_t i = 0; i < systems.size(); ++i)
+		{
+			size_t wave = 0;
+			for (size_t j = 0; j < i; ++j)
+			{
+				if (Conflict( systems[i], systems[j] )) { wave = std::max( wave, waveOf[j] + 1 ); }
+			}
+
+			waveOf[i] = wave;
+			if (wave == waves.size()) { waves.emplace_back(); }
+			waves[wave].push_back( i );
+		}
+
+		dirty = false;
+	}
+
+	bool SystemScheduler::Conflict( const System& a, const System& b )
+	{
+		return (a.writes & (b.reads | b.writes)) != 0 || (b.writes & a.reads) != 0;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Tmpl8 {
+
+	class JobSystem;
+
+	/* One bit per resource, like a component array or shared state, that systems read or write */
+	using ResourceSet = uint64_t;
+
+	/* Runs the update functions of a tick (systems) in an order that respects the resources they declare */
+	/* Not an entity-component system: the systems are plain loops over the game's pools and shared state */
+	/* Systems are split into waves: a system goes in the wave after the last earlier system it conflicts with, */
+	/* two systems conflict when one of them writes a resource the other reads or writes */
+	/* So conflicting systems still run in the order they were added */
+	/* The systems of a wave only run as parallel jobs when the time they'd overlap is worth more than submitting */
+	/* and waiting for the jobs, otherwise the calling thread runs them one after the other */
+	class SystemScheduler
+	{
+	public:
+		/* A wave is split over jobs once the systems besides its slowest one take at least this long */
+		/* Submitting and waiting on a job costs a few microseconds, so this leaves a wide margin */
+		static constexpr std::chrono::microseconds minParallelTime{ 50 };
+
+		explicit SystemScheduler( JobSystem& jobSystem );
+
+		/* Adds a system after the ones already added */
+		void Add( ResourceSet reads, ResourceSet writes, std::function<void( float )> run );
+		/* Runs every system, a wave at a time, and returns once all of them are done */
+		void Run( float deltaTime );
+
+		[[nodiscard]] size_t Size() const { return systems.size(); }
+		[[nodiscard]] size_t GetWaveCount();
+
+	private:
+		struct System
+		{
+			ResourceSet reads;
+			ResourceSet writes;
+			std::function<void( float )> run;
+			/* Moving average of how long the system takes, in seconds */
+			float averageTime{ 0.0f };
+		};
+
+		/* Sorts the systems into waves, done once after systems were added */
+		void BuildWaves();
+		/* Runs the system and updates its averageTime */
+		static void RunTimed( System& system, float deltaTime );
+		/* True when the systems of the wave besides the slowest take at least minParallelTime */
+		[[nodiscard]] bool WorthJobs( const std::vector<size_t>& wave ) const;
+		[[nodiscard]] static bool Conflict( const System& a, const System& b );
+
+		JobSystem& jobSystem;
+		std::vector<System> systems;
+		/* Indices into systems, the systems within a wave don't conflict */
+		std::vector<std::vector<size_t>> waves;
+		bool dirty{ false };
+	};
+}
\ No newline at end of file
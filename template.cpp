@@ -22,6 +22,8 @@
 #include <SDL.h>
 #include "surface.h"
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
@@ -305,6 +307,18 @@ int main( int argc, char **argv )
 //    if (!redirectIO())
 //        return 1;
 #endif
+	// "--audio-benchmark [voices] [output.wav]" only measures the audio mixer, without a window or sound card
+	if (argc > 1 && strcmp( argv[1], "--audio-benchmark" ) == 0)
+	{
+		const unsigned int voices = argc > 2 ? static_cast<unsigned int>(atoi( argv[2] )) : 32;
+		return SFX::RunMixBenchmark( voices, argc > 3 ? argv[3] : nullptr );
+	}
+	// "--audio-latency [events]" measures how long game events take to reach the sound card, without a window
+	if (argc > 1 && strcmp( argv[1], "--audio-latency" ) == 0)
+	{
+		const unsigned int events = argc > 2 ? static_cast<unsigned int>(atoi( argv[2] )) : 100;
+		return SFX::RunLatencyTest( events );
+	}
 	printf( "application started.\n" );
 	SDL_Init( SDL_INIT_VIDEO );
 #ifdef ADVANCEDGL
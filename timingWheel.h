@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "template.h"
+
+namespace Tmpl8 {
+
+	/* Timers that call back when they expire, instead of every owner counting down its own timer each tick */
+	/* Time is split into ticks of a fixed length. Timers expiring within the next 256 ticks are kept in */
+	/* the slot of their tick, later ones in coarser slots of 256 ticks that are moved down when they come up */
+	/* So advancing only costs the ticks passed plus the timers that expire */
+	/* T is what is passed to the callback, like the handle of the entity the timer belongs to */
+	template <typename T>
+	class TimingWheel
+	{
+	public:
+		explicit TimingWheel( float tickLength );
+
+		/* Calls back with payload after delay seconds, rounded up to whole ticks and at least one tick */
+		void Schedule( float delay, T payload );
+		/* Moves time forward, calls expire( payload ) for every timer that expired, in order of expiry */
+		/* expire() may schedule new timers */
+		template <typename Expire>
+		void Advance( float deltaTime, Expire expire );
+		/* Removes every timer without calling back */
+		void Clear();
+
+		[[nodiscard]] size_t Size() const { return size; }
+
+	private:
+		struct Timer
+		{
+			uint64_t deadline{ 0 };
+			T payload;
+		};
+
+		/* Puts the timer in the slot of its deadline, or the coarse slot of it */
+		void Insert( Timer&& timer );
+
+		static constexpr uint64_t fineSlots{ 256 };
+		static constexpr uint64_t coarseSlots{ 64 };
+
+		float tickLength{ 0.0f };
+		/* Time passed since the last whole tick */
+		float remainder{ 0.0f };
+		uint64_t tick{ 0 };
+		size_t size{ 0 };
+
+		std::vector<std::vector<Timer>> fine;
+		std::vector<std::vector<Timer>> coarse;
+		/* The slot being expired, so expire() can schedule into the wheel while it is gone over */
+		std::vector<Timer> expiring;
+	};
+
+	template <typename T>
+	TimingWheel<T>::TimingWheel( float _tickLength )
+		: tickLength( _tickLength )
+		, fine( fineSlots )
+		, coarse( coarseSlots )
+	{}
+
+	template <typename T>
+	void TimingWheel<T>::Schedule( float delay, T payload )
+	{
+		/* The next tick is tickLength - remainder away */
+		uint64_t ticks = static_cast<uint64_t>(Max( ceilf( (delay + remainder) / tickLength ), 1.0f ));
+
+		Insert( { tick + ticks, std::move( payload ) } );
+		size++;
+	}
+
+	template <typename T>
+	template <typename Expire>
+	void TimingWheel<T>::Advance( float deltaTime, Expire expire )
+	{
+		remainder += deltaTime;
+		while (remainder >= tickLength)
+		{
+			remainder -= tickLength;
+			tick++;
+
+			/* Entering a new coarse slot, move its timers down */
+			if (tick % fineSlots == 0)
+			{
+				expiring.swap( coarse[(tick / fineSlots) % coarseSlots] );
+				for (Timer& timer : expiring) { Insert( std::move( timer ) ); }
+				expiring.clear();
+			}
+
+			std::vector<Timer>& slot = fine[tick % fineSlots];
+			if (slot.empty()) { continue; }
+
+			expiring.swap( slot );
+			size -= expiring.size();
+			for (Timer& timer : expiring) { expire( timer.payload ); }
+			expiring.clear();
+		}
+	}
+
+	template <typename T>
+	void TimingWheel<T>::Clear()
+	{
+		for (auto& slot : fine) { slot.clear(); }
+		for (auto& slot : coarse) { slot.clear(); }
+		size = 0;
+	}
+
+	template <typename T>
+	void TimingWheel<T>::Insert( Timer&& timer )
+	{
+		if (timer.deadline - tick < fineSlots)
+		{
+			fine[timer.deadline % fineSlots].push_back( std::move( timer ) );
+			return;
+		}
+
+		/* Timers past the last coarse slot are put in it, and moved up again when it comes up */
+		uint64_t block = timer.deadline / fineSlots;
+		const uint64_t lastBlock = tick / fineSlots + coarseSlots - 1;
+		if (block > lastBlock) { block = lastBlock; }
+		coarse[block % coarseSlots].push_back( std::move( timer ) );
+	}
+}
\ No newline at end of file